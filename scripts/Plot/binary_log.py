@@ -0,0 +1,133 @@
+#
+# Reader of the binary columnar log (*.bin)
+# The format is described in src/Interface/LogOutput/BinaryLogWriter.h
+#
+
+import struct
+import numpy as np
+
+MAGIC = b'S2EBLOG\0'
+FOOTER_MAGIC = b'S2EBLEND'
+TYPE_DOUBLE = 0
+TYPE_INT64 = 1
+
+def format_shortest(value):
+  # The shortest text in the format of the CSV log which restores the value.
+  # The precision of the original text is unknown. More than 6 digits (the default precision) means that the precision was
+  # specified, and the fixed notation is used in the range of the specified precision.
+  if not np.isfinite(value):
+    return '%g' % value
+  for precision in range(1, 18):
+    if float('%.*g' % (precision, value)) == value:
+      break
+  exponent = int(np.floor(np.log10(abs(value)))) if value != 0 else 0
+  if precision > 6 and precision <= exponent < 17:
+    precision = exponent + 1
+  return '%.*g' % (precision, value)
+
+class BinaryLog:
+  def __init__(self, path):
+    self.path = path
+    self.data = np.memmap(path, dtype=np.uint8, mode='r')
+    self._read_header()
+    self._read_index()
+
+  def _read_u32(self, pos):
+    return struct.unpack_from('<I', self.data, pos)[0], pos + 4
+
+  def _read_u64(self, pos):
+    return struct.unpack_from('<Q', self.data, pos)[0], pos + 8
+
+  def _read_str(self, pos):
+    length, pos = self._read_u32(pos)
+    return bytes(self.data[pos:pos + length]).decode('utf-8'), pos + length
+
+  def _read_header(self):
+    if bytes(self.data[0:8]) != MAGIC:
+      raise ValueError(self.path + ' is not a binary log')
+    pos = 8
+    self.version, pos = self._read_u32(pos)
+    num_fields, pos = self._read_u32(pos)
+    self.num_columns, pos = self._read_u64(pos)
+    self.fields = []
+    self.column_names = []
+    self.column_types = []
+    self.column_precisions = []
+    for _ in range(num_fields):
+      field = {}
+      field['name'], pos = self._read_str(pos)
+      field['frame'], pos = self._read_str(pos)
+      field['unit'], pos = self._read_str(pos)
+      field['type'], pos = self._read_u32(pos)
+      field['rows'], pos = self._read_u32(pos)
+      field['cols'], pos = self._read_u32(pos)
+      field['precision'], pos = self._read_u32(pos)
+      num_column_names, pos = self._read_u32(pos)
+      field['column_names'] = []
+      for _ in range(num_column_names):
+        column_name, pos = self._read_str(pos)
+        field['column_names'].append(column_name)
+      self.fields.append(field)
+      self.column_names += field['column_names']
+      self.column_types += [field['type']] * num_column_names
+      self.column_precisions += [field['precision']] * num_column_names
+    self.data_offset = (pos + 7) // 8 * 8
+
+  def _read_index(self):
+    # (offset, first_row, num_rows) of each chunk
+    self.chunks = []
+    size = len(self.data)
+    if size >= self.data_offset + 16 and bytes(self.data[size - 8:size]) == FOOTER_MAGIC:
+      pos, _ = self._read_u64(size - 16)
+      num_chunks, _ = self._read_u64(pos + 8)
+      pos += 16
+      for _ in range(num_chunks):
+        self.chunks.append(struct.unpack_from('<QQQ', self.data, pos))
+        pos += 24
+      return
+    # The file is not closed normally. Scan the chunks.
+    pos = self.data_offset
+    while pos + 16 <= size and bytes(self.data[pos:pos + 4]) == b'CHNK':
+      num_rows, _ = self._read_u32(pos + 4)
+      first_row, _ = self._read_u64(pos + 8)
+      end = pos + 16 + num_rows * self.num_columns * 8
+      if end > size:
+        break
+      self.chunks.append((pos, first_row, num_rows))
+      pos = end
+
+  def num_rows(self):
+    return sum(chunk[2] for chunk in self.chunks)
+
+  def column(self, name_or_index):
+    # Values of a column as a numpy array. Each chunk is a view of the memory mapped file.
+    index = name_or_index if isinstance(name_or_index, int) else self.column_names.index(name_or_index)
+    dtype = '<i8' if self.column_types[index] == TYPE_INT64 else '<f8'
+    parts = []
+    for offset, _, num_rows in self.chunks:
+      begin = offset + 16 + index * num_rows * 8
+      parts.append(self.data[begin:begin + num_rows * 8].view(dtype))
+    if len(parts) == 0:
+      return np.zeros(0, dtype=dtype)
+    return np.concatenate(parts)
+
+  def to_csv(self, csv_path):
+    # Same layout as the CSV log
+    formats = []
+    for column_type, precision in zip(self.column_types, self.column_precisions):
+      if column_type == TYPE_INT64:
+        formats.append(lambda value: '%d' % value)
+      elif precision == 0:
+        formats.append(format_shortest)
+      else:
+        formats.append(lambda value, fmt='%.' + str(precision) + 'g': fmt % value)
+    with open(csv_path, 'w', newline='\n') as f:
+      f.write(''.join(name + ',' for name in self.column_names) + '\n')
+      for offset, _, num_rows in self.chunks:
+        columns = []
+        for index in range(self.num_columns):
+          dtype = '<i8' if self.column_types[index] == TYPE_INT64 else '<f8'
+          begin = offset + 16 + index * num_rows * 8
+          columns.append(self.data[begin:begin + num_rows * 8].view(dtype).tolist())
+        for row in range(num_rows):
+          f.write(''.join(formats[index](columns[index][row]) + ',' for index in range(self.num_columns)) + '\n')
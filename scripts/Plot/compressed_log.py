@@ -0,0 +1,126 @@
+#
+# Reader of the compressed log (*.lz4b)
+# The format is described in src/Interface/LogOutput/CompressedLogStreamBuf.h
+#
+
+import bisect
+import struct
+
+try:
+  import lz4.block
+except ImportError:
+  lz4 = None
+
+MAGIC = b'S2ELZ4B\0'
+FOOTER_MAGIC = b'S2ELZEND'
+STORED_FLAG = 0x80000000
+
+def decompress_lz4_block(src, raw_size):
+  # Decompress a block in the LZ4 block format. The LZ4 library is used when it is installed.
+  if lz4 is not None:
+    return lz4.block.decompress(src, uncompressed_size=raw_size)
+  dst = bytearray()
+  pos = 0
+  while pos < len(src):
+    token = src[pos]
+    pos += 1
+    literal_length = token >> 4
+    if literal_length == 15:
+      while True:
+        byte = src[pos]
+        pos += 1
+        literal_length += byte
+        if byte != 255:
+          break
+    dst += src[pos:pos + literal_length]
+    pos += literal_length
+    if pos >= len(src):
+      break
+    offset = src[pos] | (src[pos + 1] << 8)
+    pos += 2
+    match_length = token & 0x0f
+    if match_length == 15:
+      while True:
+        byte = src[pos]
+        pos += 1
+        match_length += byte
+        if byte != 255:
+          break
+    match_length += 4
+    start = len(dst) - offset
+    if offset >= match_length:
+      dst += dst[start:start + match_length]
+    else:
+      # The match overlaps the output
+      for i in range(match_length):
+        dst.append(dst[start + i])
+  if len(dst) != raw_size:
+    raise ValueError('Broken block')
+  return bytes(dst)
+
+class CompressedLog:
+  def __init__(self, path):
+    self.path = path
+    with open(path, 'rb') as f:
+      self.data = f.read()
+    if self.data[0:8] != MAGIC:
+      raise ValueError(path + ' is not a compressed log')
+    self.version, self.block_size = struct.unpack_from('<II', self.data, 8)
+    self._read_index()
+
+  def _read_index(self):
+    # (offset in the file, offset in the decompressed data) of each block
+    self.blocks = []
+    if len(self.data) >= 32 and self.data[-8:] == FOOTER_MAGIC:
+      index_offset = struct.unpack_from('<Q', self.data, len(self.data) - 16)[0]
+      if self.data[index_offset:index_offset + 4] == b'INDX':
+        num_blocks = struct.unpack_from('<Q', self.data, index_offset + 8)[0]
+        for i in range(num_blocks):
+          self.blocks.append(struct.unpack_from('<QQ', self.data, index_offset + 16 + 16 * i))
+        self.raw_size = self._block_end(len(self.blocks) - 1) if self.blocks else 0
+        return
+    # The file is not closed normally. Read the blocks sequentially.
+    pos = 16
+    raw_offset = 0
+    while pos + 8 <= len(self.data):
+      stored_size, raw_size = struct.unpack_from('<II', self.data, pos)
+      stored_size &= ~STORED_FLAG
+      if pos + 8 + stored_size > len(self.data):
+        break
+      self.blocks.append((pos, raw_offset))
+      pos += 8 + stored_size
+      raw_offset += raw_size
+    self.raw_size = raw_offset
+
+  def _block_end(self, i):
+    pos, raw_offset = self.blocks[i]
+    return raw_offset + struct.unpack_from('<I', self.data, pos + 4)[0]
+
+  def num_blocks(self):
+    return len(self.blocks)
+
+  def block(self, i):
+    # Decompressed bytes of the i-th block
+    pos = self.blocks[i][0]
+    stored_size, raw_size = struct.unpack_from('<II', self.data, pos)
+    stored = self.data[pos + 8:pos + 8 + (stored_size & ~STORED_FLAG)]
+    if stored_size & STORED_FLAG:
+      return stored
+    return decompress_lz4_block(stored, raw_size)
+
+  def read(self, offset, size):
+    # Decompressed bytes in [offset, offset + size). Only the blocks in the range are decompressed.
+    raw_offsets = [block[1] for block in self.blocks]
+    i = max(bisect.bisect_right(raw_offsets, offset) - 1, 0)
+    result = bytearray()
+    while i < len(self.blocks) and len(result) < size:
+      data = self.block(i)
+      start = max(offset - self.blocks[i][1], 0)
+      result += data[start:start + size - len(result)]
+      i += 1
+    return bytes(result)
+
+  def decompress(self, output):
+    with open(output, 'wb') as f:
+      for i in range(len(self.blocks)):
+        f.write(self.block(i))
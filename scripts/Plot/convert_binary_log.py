@@ -0,0 +1,29 @@
+#
+# Convert the binary columnar log (*.bin) to the CSV log
+#
+# arg[1] : input : path to the binary log file
+# arg[2] : output : path to the CSV file (default: the input path with the extension .csv)
+#
+
+#
+# Import
+#
+from binary_log import BinaryLog
+# arguments
+import argparse
+import os
+
+aparser = argparse.ArgumentParser()
+
+aparser.add_argument('input', type=str, help='binary log file like ../../data/SampleSat/logs/logs_220627_142946/220627_142946_default.bin')
+aparser.add_argument('output', type=str, nargs='?', help='output CSV file', default=None)
+
+args = aparser.parse_args()
+
+output = args.output
+if output is None:
+  output = os.path.splitext(args.input)[0] + '.csv'
+
+log = BinaryLog(args.input)
+log.to_csv(output)
+print('Converted ' + str(log.num_rows()) + ' rows to ' + output)
@@ -0,0 +1,29 @@
+#
+# Decompress the compressed log (*.lz4b) to the original log file
+#
+# arg[1] : input : path to the compressed log file
+# arg[2] : output : path to the output file (default: the input path without the extension .lz4b)
+#
+
+#
+# Import
+#
+from compressed_log import CompressedLog
+# arguments
+import argparse
+import os
+
+aparser = argparse.ArgumentParser()
+
+aparser.add_argument('input', type=str, help='compressed log file like ../../data/SampleSat/logs/logs_220627_142946/220627_142946_default.csv.lz4b')
+aparser.add_argument('output', type=str, nargs='?', help='output file', default=None)
+
+args = aparser.parse_args()
+
+output = args.output
+if output is None:
+  output = os.path.splitext(args.input)[0]
+
+log = CompressedLog(args.input)
+log.decompress(output)
+print('Decompressed ' + str(log.num_blocks()) + ' blocks (' + str(log.raw_size) + ' bytes) to ' + output)
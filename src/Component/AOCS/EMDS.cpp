@@ -22,22 +22,14 @@ void EMDS::Update(EMDS& other) {
   other.torque_b_ = results[3];
 }
 
-std::string EMDS::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("emds_force", "b", "N", 3);
-  str_tmp += WriteVector("emds_torque", "b", "Nm", 3);
-
-  return str_tmp;
+void EMDS::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("emds_force", "b", "N", 3);
+  schema.AddVector("emds_torque", "b", "Nm", 3);
 }
 
-std::string EMDS::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(force_b_);
-  str_tmp += WriteVector(torque_b_);
-
-  return str_tmp;
+void EMDS::LogValues(LogSink& sink) const {
+  sink.Add(force_b_);
+  sink.Add(torque_b_);
 }
 
 void EMDS::SetParameters(Vector<3> position, Quaternion quaternion, double current) {
@@ -21,8 +21,8 @@ class EMDS : public ILoggable {
   inline Vector<3> GetTorque_b() { return torque_b_; }
   inline Vector<3> GetForce_b() { return force_b_; }
 
-  virtual std::string GetLogHeader() const;
-  virtual std::string GetLogValue() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
+  virtual void LogValues(LogSink& sink) const;
 
   // position: position of C.G. of s/c in inertia frame
   // quaternion: quaternion from inertia to body frame
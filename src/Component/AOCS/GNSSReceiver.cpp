@@ -192,42 +192,34 @@ void GNSSReceiver::ConvertJulianDayToGPSTime(const double JulianDay) {
   gpstime_sec_ = (elapsed_day - (double)(gpstime_week_)*kDayInWeek) * kSecInDay;
 }
 
-std::string GNSSReceiver::GetLogHeader() const  // For logs
-{
-  std::string str_tmp = "";
-  str_tmp += WriteScalar("gnss_year");
-  str_tmp += WriteScalar("gnss_month");
-  str_tmp += WriteScalar("gnss_day");
-  str_tmp += WriteScalar("gnss_hour");
-  str_tmp += WriteScalar("gnss_min");
-  str_tmp += WriteScalar("gnss_sec");
-  str_tmp += WriteVector("gnss_position", "eci", "m", 3);
-  str_tmp += WriteVector("gnss_velocity", "ecef", "m/s", 3);
-  str_tmp += WriteScalar("gnss_lat", "rad");
-  str_tmp += WriteScalar("gnss_lon", "rad");
-  str_tmp += WriteScalar("gnss_alt", "m");
-  str_tmp += WriteScalar("gnss_vis_flag");
-  str_tmp += WriteScalar("gnss_vis_num");
-
-  return str_tmp;
+void GNSSReceiver::GetLogSchema(LogSchema& schema) const {
+  schema.AddColumn("gnss_year", 6, LogValueType::Int64);
+  schema.AddColumn("gnss_month", 6, LogValueType::Int64);
+  schema.AddColumn("gnss_day", 6, LogValueType::Int64);
+  schema.AddColumn("gnss_hour", 6, LogValueType::Int64);
+  schema.AddColumn("gnss_min", 6, LogValueType::Int64);
+  schema.AddColumn("gnss_sec");
+  schema.AddVector("gnss_position", "eci", "m", 3, 10);
+  schema.AddVector("gnss_velocity", "ecef", "m/s", 3, 10);
+  schema.AddScalar("gnss_lat", "rad", 10);
+  schema.AddScalar("gnss_lon", "rad", 10);
+  schema.AddScalar("gnss_alt", "m", 10);
+  schema.AddColumn("gnss_vis_flag", 6, LogValueType::Int64);
+  schema.AddColumn("gnss_vis_num", 6, LogValueType::Int64);
 }
 
-std::string GNSSReceiver::GetLogValue() const  // For logs
-{
-  std::string str_tmp = "";
-  str_tmp += WriteScalar(utc_.year);
-  str_tmp += WriteScalar(utc_.month);
-  str_tmp += WriteScalar(utc_.day);
-  str_tmp += WriteScalar(utc_.hour);
-  str_tmp += WriteScalar(utc_.min);
-  str_tmp += WriteScalar(utc_.sec);
-  str_tmp += WriteVector(position_eci_, 10);
-  str_tmp += WriteVector(velocity_ecef_, 10);
-  str_tmp += WriteScalar(position_llh_[0], 10);
-  str_tmp += WriteScalar(position_llh_[1], 10);
-  str_tmp += WriteScalar(position_llh_[2], 10);
-  str_tmp += WriteScalar(is_gnss_sats_visible_);
-  str_tmp += WriteScalar(gnss_sats_visible_num_);
-
-  return str_tmp;
+void GNSSReceiver::LogValues(LogSink& sink) const {
+  sink.Add(utc_.year);
+  sink.Add(utc_.month);
+  sink.Add(utc_.day);
+  sink.Add(utc_.hour);
+  sink.Add(utc_.min);
+  sink.Add(utc_.sec);
+  sink.Add(position_eci_);
+  sink.Add(velocity_ecef_);
+  sink.Add(position_llh_[0]);
+  sink.Add(position_llh_[1]);
+  sink.Add(position_llh_[2]);
+  sink.Add(is_gnss_sats_visible_);
+  sink.Add(gnss_sats_visible_num_);
 }
@@ -24,20 +24,13 @@ void Gyro::MainRoutine(int count) {
   omega_c_ = Measure(omega_c_);                                         // Add noises
 }
 
-std::string Gyro::GetLogHeader() const {
-  std::string str_tmp = "";
+void Gyro::GetLogSchema(LogSchema& schema) const {
   const std::string st_sensor_id = std::to_string(static_cast<long long>(sensor_id_));
   const char* cs = st_sensor_id.data();
   std::string GSection = "gyro_omega";
-  str_tmp += WriteVector(GSection + cs, "c", "rad/s", kGyroDim);
-
-  return str_tmp;
+  schema.AddVector(GSection + cs, "c", "rad/s", kGyroDim);
 }
 
-std::string Gyro::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(omega_c_);
-
-  return str_tmp;
+void Gyro::LogValues(LogSink& sink) const {
+  sink.Add(omega_c_);
 }
@@ -21,20 +21,13 @@ void MagSensor::MainRoutine(int count) {
   mag_c_ = Measure(mag_c_);                         // Add noises
 }
 
-std::string MagSensor::GetLogHeader() const {
-  std::string str_tmp = "";
+void MagSensor::GetLogSchema(LogSchema& schema) const {
   const std::string st_sensor_id = std::to_string(static_cast<long long>(sensor_id_));
   const char* cs = st_sensor_id.data();
   std::string MSSection = "mag_sensor";
-  str_tmp += WriteVector(MSSection + cs, "c", "nT", kMagDim);
-
-  return str_tmp;
+  schema.AddVector(MSSection + cs, "c", "nT", kMagDim);
 }
 
-std::string MagSensor::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(mag_c_);
-
-  return str_tmp;
+void MagSensor::LogValues(LogSink& sink) const {
+  sink.Add(mag_c_);
 }
@@ -82,22 +82,16 @@ libra::Vector<kMtqDim> MagTorquer::CalcOutputTorque(void) {
   return torque_b_;
 }
 
-std::string MagTorquer::GetLogHeader() const {
-  std::string str_tmp = "";
+void MagTorquer::GetLogSchema(LogSchema& schema) const {
   const std::string st_sensor_id = std::to_string(static_cast<long long>(id_));
   const char* cs = st_sensor_id.data();
   std::string MSSection = "mag_torquer";
 
-  str_tmp += WriteVector(MSSection + cs, "b", "Am^2", kMtqDim);
-  str_tmp += WriteVector(MSSection + cs, "b", "Nm", kMtqDim);
-
-  return str_tmp;
+  schema.AddVector(MSSection + cs, "b", "Am^2", kMtqDim);
+  schema.AddVector(MSSection + cs, "b", "Nm", kMtqDim);
 }
 
-std::string MagTorquer::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteVector(mag_moment_b_);
-  str_tmp += WriteVector(torque_b_);
-
-  return str_tmp;
+void MagTorquer::LogValues(LogSink& sink) const {
+  sink.Add(mag_moment_b_);
+  sink.Add(torque_b_);
 }
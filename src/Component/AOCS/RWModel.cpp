@@ -178,34 +178,26 @@ void RWModel::SetVelocityLimitRpm(double velocity_limit_rpm) {
   return;
 }
 
-std::string RWModel::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteScalar("rw_angular_velocity", "rad/s");
-  str_tmp += WriteScalar("rw_angular_velocity_rpm", "rpm");
-  str_tmp += WriteScalar("rw_angular_velocity_upperlimit", "rpm");
-  str_tmp += WriteScalar("rw_angular_acceleration", "rad/s^2");
+void RWModel::GetLogSchema(LogSchema& schema) const {
+  schema.AddScalar("rw_angular_velocity", "rad/s");
+  schema.AddScalar("rw_angular_velocity_rpm", "rpm");
+  schema.AddScalar("rw_angular_velocity_upperlimit", "rpm");
+  schema.AddScalar("rw_angular_acceleration", "rad/s^2");
 
   if (is_logged_jitter_) {
-    str_tmp += WriteVector("rw_jitter_force", "c", "N", 3);
-    str_tmp += WriteVector("rw_jitter_torque", "c", "Nm", 3);
+    schema.AddVector("rw_jitter_force", "c", "N", 3);
+    schema.AddVector("rw_jitter_torque", "c", "Nm", 3);
   }
-
-  return str_tmp;
 }
 
-std::string RWModel::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteScalar(angular_velocity_rad_);
-  str_tmp += WriteScalar(angular_velocity_rpm_);
-  str_tmp += WriteScalar(velocity_limit_rpm_);
-  str_tmp += WriteScalar(angular_acceleration_);
+void RWModel::LogValues(LogSink& sink) const {
+  sink.Add(angular_velocity_rad_);
+  sink.Add(angular_velocity_rpm_);
+  sink.Add(velocity_limit_rpm_);
+  sink.Add(angular_acceleration_);
 
   if (is_logged_jitter_) {
-    str_tmp += WriteVector(rw_jitter_.GetJitterForceC());
-    str_tmp += WriteVector(rw_jitter_.GetJitterTorqueC());
+    sink.Add(rw_jitter_.GetJitterForceC());
+    sink.Add(rw_jitter_.GetJitterTorqueC());
   }
-
-  return str_tmp;
 }
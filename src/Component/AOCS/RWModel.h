@@ -115,15 +115,15 @@ class RWModel : public ComponentBase, public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
   // Getter
   /**
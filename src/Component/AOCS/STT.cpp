@@ -175,23 +175,16 @@ int STT::CaptureRateJudgement(const libra::Vector<3>& omega_b) {
     return 0;
 }
 
-std::string STT::GetLogHeader() const {
-  std::string str_tmp = "";
+void STT::GetLogSchema(LogSchema& schema) const {
   const std::string sensor_id = std::to_string(static_cast<long long>(id_));
 
-  str_tmp += WriteVector("quaternion_STT" + sensor_id, "i2c", "-", 4);
-  str_tmp += WriteScalar("STT error flag" + sensor_id);
-
-  return str_tmp;
+  schema.AddVector("quaternion_STT" + sensor_id, "i2c", "-", 4);
+  schema.AddColumn("STT error flag" + sensor_id);
 }
 
-std::string STT::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteQuaternion(q_stt_i2c_);
-  str_tmp += WriteScalar(double(error_flag_));
-
-  return str_tmp;
+void STT::LogValues(LogSink& sink) const {
+  sink.Add(q_stt_i2c_);
+  sink.Add(double(error_flag_));
 }
 
 double STT::CalAngleVect_rad(const Vector<3>& vect1, const Vector<3>& vect2) {
@@ -128,21 +128,14 @@ double SunSensor::TanRange(double x) {
   return x;
 }
 
-string SunSensor::GetLogHeader() const {
-  string str_tmp = "";
+void SunSensor::GetLogSchema(LogSchema& schema) const {
   const string st_id = std::to_string(static_cast<long long>(id_));
 
-  str_tmp += WriteVector("sun" + st_id, "c", "-", 3);
-  str_tmp += WriteScalar("sun_detected_flag" + st_id, "-");
-
-  return str_tmp;
+  schema.AddVector("sun" + st_id, "c", "-", 3);
+  schema.AddScalar("sun_detected_flag" + st_id, "-");
 }
 
-string SunSensor::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector(measured_sun_c_);
-  str_tmp += WriteScalar(double(sun_detected_flag_));
-
-  return str_tmp;
+void SunSensor::LogValues(LogSink& sink) const {
+  sink.Add(measured_sun_c_);
+  sink.Add(double(sun_detected_flag_));
 }
@@ -62,18 +62,10 @@ double GScalculator::CalcMaxBitrate(const Dynamics& dynamics, const Antenna& sc_
   }
 }
 
-std::string GScalculator::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteScalar("max bitrate[Mbps]");
-
-  return str_tmp;
+void GScalculator::GetLogSchema(LogSchema& schema) const {
+  schema.AddColumn("max bitrate[Mbps]");
 }
 
-std::string GScalculator::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteScalar(max_bitrate_);
-
-  return str_tmp;
+void GScalculator::LogValues(LogSink& sink) const {
+  sink.Add(max_bitrate_);
 }
@@ -61,27 +61,19 @@ void ForceGenerator::SetForce_rtn_N(const libra::Vector<3> force_rtn_N) {
   ordered_force_b_N_ = q_i2b.frame_conv(force_i_N);
 }
 
-std::string ForceGenerator::GetLogHeader() const {
-  std::string str_tmp = "";
-
+void ForceGenerator::GetLogSchema(LogSchema& schema) const {
   std::string head = "IdealForceGenerator_";
-  str_tmp += WriteVector(head + "ordered_force", "b", "N", 3);
-  str_tmp += WriteVector(head + "generated_force", "b", "N", 3);
-  str_tmp += WriteVector(head + "generated_force", "i", "N", 3);
-  str_tmp += WriteVector(head + "generated_force", "rtn", "N", 3);
-
-  return str_tmp;
+  schema.AddVector(head + "ordered_force", "b", "N", 3);
+  schema.AddVector(head + "generated_force", "b", "N", 3);
+  schema.AddVector(head + "generated_force", "i", "N", 3);
+  schema.AddVector(head + "generated_force", "rtn", "N", 3);
 }
 
-std::string ForceGenerator::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(ordered_force_b_N_);
-  str_tmp += WriteVector(generated_force_b_N_);
-  str_tmp += WriteVector(generated_force_i_N_);
-  str_tmp += WriteVector(generated_force_rtn_N_);
-
-  return str_tmp;
+void ForceGenerator::LogValues(LogSink& sink) const {
+  sink.Add(ordered_force_b_N_);
+  sink.Add(generated_force_b_N_);
+  sink.Add(generated_force_i_N_);
+  sink.Add(generated_force_rtn_N_);
 }
 
 libra::Quaternion ForceGenerator::GenerateDirectionNoiseQuaternion(libra::Vector<3> true_direction, const double error_standard_deviation_rad) {
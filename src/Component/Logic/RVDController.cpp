@@ -61,18 +61,14 @@ Vector<3> RVDController::CalcRW(Quaternion q_ib_now) {
   return res;
 }
 
-std::string RVDController::GetLogHeader() const {
-  std::string str_tmp = "";
-  str_tmp += WriteVector("thrust", "b", "N", 3);
-  str_tmp += WriteVector("torque", "b", "Nm", 3);
-  return str_tmp;
+void RVDController::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("thrust", "b", "N", 3);
+  schema.AddVector("torque", "b", "Nm", 3);
 }
 
-std::string RVDController::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteVector(thrust_b_);
-  str_tmp += WriteVector(torque_);
-  return str_tmp;
+void RVDController::LogValues(LogSink& sink) const {
+  sink.Add(thrust_b_);
+  sink.Add(torque_);
 }
 
 double RVDController::acos_tolerant(double x) {
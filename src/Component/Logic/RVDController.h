@@ -39,8 +39,8 @@ class RVDController : public ILoggable {
   inline Vector<3> GetTorque() { return torque_; }
   inline void ClearForce() { thrust_b_ *= 0; }
 
-  virtual std::string GetLogHeader() const;
-  virtual std::string GetLogValue() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
+  virtual void LogValues(LogSink& sink) const;
 
  private:
   double acos_tolerant(double x);
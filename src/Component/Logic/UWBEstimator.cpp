@@ -103,21 +103,17 @@ bool UWBEstimator::IsConverged() {
   return isconverged;
 }
 
-std::string UWBEstimator::GetLogHeader() const {
-  std::string str_tmp = "";
-  str_tmp += WriteVector("RelPosEst", "i", "m", 3);
-  str_tmp += WriteVector("RelVelEst", "i", "m/s", 3);
-  str_tmp += WriteVector("UWBObs", "i", "m", 12);
-  str_tmp += WriteVector("Fcontrol", "i", "N", 6);
-  return str_tmp;
+void UWBEstimator::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("RelPosEst", "i", "m", 3);
+  schema.AddVector("RelVelEst", "i", "m/s", 3);
+  schema.AddVector("UWBObs", "i", "m", 12);
+  schema.AddVector("Fcontrol", "i", "N", 6);
 }
 
-std::string UWBEstimator::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteVector(x);
-  str_tmp += WriteVector(lastObservation);
-  str_tmp += WriteVector(Fcontrol_i);
-  return str_tmp;
+void UWBEstimator::LogValues(LogSink& sink) const {
+  sink.Add(x);
+  sink.Add(lastObservation);
+  sink.Add(Fcontrol_i);
 }
 
 Vector<3> UWBEstimator::distanceVector(Vector<3> L, Quaternion qt_i2b, Quaternion qc_i2b, Vector<3> post_b, Vector<3> posc_b) {
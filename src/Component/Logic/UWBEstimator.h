@@ -32,8 +32,8 @@ class UWBEstimator : public ILoggable {
   void SetX(Vector<6> x_new);
   bool IsConverged();
 
-  std::string GetLogHeader() const;
-  std::string GetLogValue() const;
+  void GetLogSchema(LogSchema& schema) const;
+  void LogValues(LogSink& sink) const;
 
  private:
   double Rinf = 1000000;
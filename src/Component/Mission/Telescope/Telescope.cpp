@@ -32,6 +32,10 @@ Telescope::Telescope(ClockGenerator* clock_gen, libra::Quaternion& q_b2c, double
   is_earth_in_forbidden_angle = true;
   is_moon_in_forbidden_angle = true;
 
+  sun_id_ = local_celes_info_->GetGlobalInfo().CalcBodyIdFromName("SUN");
+  earth_id_ = local_celes_info_->GetGlobalInfo().CalcBodyIdFromName("EARTH");
+  moon_id_ = local_celes_info_->GetGlobalInfo().CalcBodyIdFromName("MOON");
+
   x_field_of_view_rad = x_num_of_pix_ * x_fov_par_pix_;
   y_field_of_view_rad = y_num_of_pix_ * y_fov_par_pix_;
   assert(x_field_of_view_rad < libra::pi_2);  // Avoid the case that the field of view is over 90 degrees
@@ -59,13 +63,13 @@ Telescope::~Telescope() {}
 void Telescope::MainRoutine(int count) {
   UNUSED(count);
   // Check forbidden angle
-  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b("SUN"), sun_forbidden_angle_);
-  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b("EARTH"), earth_forbidden_angle_);
-  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b("MOON"), moon_forbidden_angle_);
+  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b(sun_id_), sun_forbidden_angle_);
+  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b(earth_id_), earth_forbidden_angle_);
+  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b(moon_id_), moon_forbidden_angle_);
   // Position calculation of celestial bodies from CelesInfo
-  Observe(sun_pos_imgsensor, local_celes_info_->GetPosFromSC_b("SUN"));
-  Observe(earth_pos_imgsensor, local_celes_info_->GetPosFromSC_b("EARTH"));
-  Observe(moon_pos_imgsensor, local_celes_info_->GetPosFromSC_b("MOON"));
+  Observe(sun_pos_imgsensor, local_celes_info_->GetPosFromSC_b(sun_id_));
+  Observe(earth_pos_imgsensor, local_celes_info_->GetPosFromSC_b(earth_id_));
+  Observe(moon_pos_imgsensor, local_celes_info_->GetPosFromSC_b(moon_id_));
   // Position calculation of stars from Hipparcos Catalogue
   // No update when Hipparocos Catalogue was not readed
   if (hipp_->IsCalcEnabled) ObserveStars();
@@ -148,52 +152,48 @@ void Telescope::ObserveStars() {
   }
 }
 
-string Telescope::GetLogHeader() const {
-  string str_tmp = "";
-  str_tmp += WriteScalar("Sun in forbidden angle", "");
-  str_tmp += WriteScalar("Earth in forbidden angle", "");
-  str_tmp += WriteScalar("Moon in forbidden angle", "");
-  str_tmp += WriteVector("sun_pos_imgsensor", " ", "pix", 2);
-  str_tmp += WriteVector("earth_pos_imgsensor", " ", "pix", 2);
-  str_tmp += WriteVector("moon_pos_imgsensor", " ", "pix", 2);
+void Telescope::GetLogSchema(LogSchema& schema) const {
+  schema.AddScalar("Sun in forbidden angle", "", 6, LogValueType::Int64);
+  schema.AddScalar("Earth in forbidden angle", "", 6, LogValueType::Int64);
+  schema.AddScalar("Moon in forbidden angle", "", 6, LogValueType::Int64);
+  schema.AddVector("sun_pos_imgsensor", " ", "pix", 2);
+  schema.AddVector("earth_pos_imgsensor", " ", "pix", 2);
+  schema.AddVector("moon_pos_imgsensor", " ", "pix", 2);
   // When Hipparcos Catalogue was not read, no output of ObserveStars
   if (hipp_->IsCalcEnabled) {
     for (size_t i = 0; i < num_of_logged_stars_; i++) {
-      str_tmp += WriteScalar("HIP ID (" + to_string(i) + ")", " ");
-      str_tmp += WriteScalar("Vmag (" + to_string(i) + ")", " ");
-      str_tmp += WriteVector("pos_imagesensor (" + to_string(i) + ")", " ", "pix", 2);
+      schema.AddScalar("HIP ID (" + to_string(i) + ")", " ", 6, LogValueType::Int64);
+      schema.AddScalar("Vmag (" + to_string(i) + ")", " ");
+      schema.AddVector("pos_imagesensor (" + to_string(i) + ")", " ", "pix", 2);
     }
   }
 
   // Debug output **********************************************
-  //  str_tmp += WriteScalar("angle_sun", "");
-  //  str_tmp += WriteScalar("angle_earth", "");
-  //  str_tmp += WriteScalar("angle_moon", "");
+  //  schema.AddScalar("angle_sun", "");
+  //  schema.AddScalar("angle_earth", "");
+  //  schema.AddScalar("angle_moon", "");
   //**********************************************************
-  return str_tmp;
 }
 
-string Telescope::GetLogValue() const {
-  string str_tmp = "";
-  str_tmp += WriteScalar(is_sun_in_forbidden_angle);
-  str_tmp += WriteScalar(is_earth_in_forbidden_angle);
-  str_tmp += WriteScalar(is_moon_in_forbidden_angle);
-  str_tmp += WriteVector(sun_pos_imgsensor);
-  str_tmp += WriteVector(earth_pos_imgsensor);
-  str_tmp += WriteVector(moon_pos_imgsensor);
+void Telescope::LogValues(LogSink& sink) const {
+  sink.Add(is_sun_in_forbidden_angle);
+  sink.Add(is_earth_in_forbidden_angle);
+  sink.Add(is_moon_in_forbidden_angle);
+  sink.Add(sun_pos_imgsensor);
+  sink.Add(earth_pos_imgsensor);
+  sink.Add(moon_pos_imgsensor);
   // When Hipparcos Catalogue was not read, no output of ObserveStars
   if (hipp_->IsCalcEnabled) {
     for (size_t i = 0; i < num_of_logged_stars_; i++) {
-      str_tmp += WriteScalar(star_in_sight[i].hipdata.hip_num);
-      str_tmp += WriteScalar(star_in_sight[i].hipdata.vmag);
-      str_tmp += WriteVector(star_in_sight[i].pos_imgsensor);
+      sink.Add(star_in_sight[i].hipdata.hip_num);
+      sink.Add(star_in_sight[i].hipdata.vmag);
+      sink.Add(star_in_sight[i].pos_imgsensor);
     }
   }
 
   // Debug output **********************************************
-  //  str_tmp += WriteScalar(angle_sun);
-  //  str_tmp += WriteScalar(angle_earth);
-  //  str_tmp += WriteScalar(angle_moon);
+  //  sink.Add(angle_sun);
+  //  sink.Add(angle_earth);
+  //  sink.Add(angle_moon);
   //**********************************************************
-  return str_tmp;
 }
@@ -99,18 +99,21 @@ class Telescope : public ComponentBase, public ILoggable {
   const Attitude* attitude_;                           //!< Attitude information
   const HipparcosCatalogue* hipp_;                     //!< Star information
   const LocalCelestialInformation* local_celes_info_;  //!< Local celestial information
+  int sun_id_;                                         //!< ID of the sun in the CelestialInformation list
+  int earth_id_;                                       //!< ID of the earth in the CelestialInformation list
+  int moon_id_;                                        //!< ID of the moon in the CelestialInformation list
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
   // For debug **********************************************
   //  Vector<3> sun_pos_c;
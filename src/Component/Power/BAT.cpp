@@ -62,18 +62,14 @@ double BAT::GetCCChargeCurrent() const { return cc_charge_current_; }
 
 double BAT::GetCVChargeVoltage() const { return cv_charge_voltage_; }
 
-std::string BAT::GetLogHeader() const {
-  std::string str_tmp = "";
-  str_tmp += WriteScalar("bat_voltage", "V");
-  str_tmp += WriteScalar("DoD", "%");
-  return str_tmp;
+void BAT::GetLogSchema(LogSchema& schema) const {
+  schema.AddScalar("bat_voltage", "V");
+  schema.AddScalar("DoD", "%");
 }
 
-std::string BAT::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteScalar(bat_voltage_);
-  str_tmp += WriteScalar(dod_);
-  return str_tmp;
+void BAT::LogValues(LogSink& sink) const {
+  sink.Add(bat_voltage_);
+  sink.Add(dod_);
 }
 
 void BAT::MainRoutine(int time_count) {
@@ -7,34 +7,42 @@
 
 #include <Interface/InitInput/IniAccess.h>
 
+#include <mutex>
+
 bool CsvScenarioInterface::is_csv_senario_enabled_;
 std::map<std::string, unsigned int> CsvScenarioInterface::buffer_line_id_;
 std::map<std::string, DoubleBuffer> CsvScenarioInterface::buffers_;
+std::shared_mutex CsvScenarioInterface::buffer_mutex_;
 
 void CsvScenarioInterface::Initialize(const std::string fname) {
   IniAccess scenario_conf(fname);
   char Section[30] = "SCENARIO";
 
-  CsvScenarioInterface::is_csv_senario_enabled_ = scenario_conf.ReadBoolean(Section, "is_csv_scenario_enabled");
+  const bool is_csv_senario_enabled = scenario_conf.ReadBoolean(Section, "is_csv_scenario_enabled");
 
   std::string csv_path;
   csv_path = scenario_conf.ReadString(Section, "csv_path");
 
+  std::vector<std::vector<double>> data;
+  data = ReadCsvData(csv_path, 1);
+
+  std::unique_lock<std::shared_mutex> lock(buffer_mutex_);
+  CsvScenarioInterface::is_csv_senario_enabled_ = is_csv_senario_enabled;
   buffer_line_id_["sun_dir_b_x"] = 1;
   buffer_line_id_["sun_dir_b_y"] = 2;
   buffer_line_id_["sun_dir_b_z"] = 3;
   buffer_line_id_["sun_flag"] = 4;
   buffer_line_id_["power_consumption"] = 5;
 
-  std::vector<std::vector<double>> data;
-  data = ReadCsvData(csv_path, 1);
-
   for (auto itr = buffer_line_id_.begin(); itr != buffer_line_id_.end(); itr++) {
     StoreBuffer(itr->first, data);
   }
 }
 
-bool CsvScenarioInterface::IsCsvScenarioEnabled() { return CsvScenarioInterface::is_csv_senario_enabled_; }
+bool CsvScenarioInterface::IsCsvScenarioEnabled() {
+  std::shared_lock<std::shared_mutex> lock(buffer_mutex_);
+  return CsvScenarioInterface::is_csv_senario_enabled_;
+}
 
 libra::Vector<3> CsvScenarioInterface::GetSunDirectionBody(const double time_query) {
   libra::Vector<3> sun_dir_b;
@@ -85,6 +93,7 @@ void CsvScenarioInterface::StoreBuffer(const std::string buffer_name, const std:
 }
 
 double CsvScenarioInterface::GetValueFromBuffer(const std::string buffer_name, const double time_query) {
+  std::shared_lock<std::shared_mutex> lock(buffer_mutex_);
   double output;
   auto itr = buffers_.at(buffer_name).upper_bound(time_query);
   itr--;
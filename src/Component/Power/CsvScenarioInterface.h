@@ -6,6 +6,7 @@
 
 #include <Library/math/Vector.hpp>
 #include <map>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -14,6 +15,8 @@ typedef std::map<double, double> DoubleBuffer;
 /*
  * @class CsvScenarioInterface
  * @brief Interface to read power related scenario in CSV file
+ * @note The scenario is shared by all simulation cases. The buffers are guarded by a lock since the cases of the parallel Monte-Carlo
+ *       simulation initialize and read them from different threads.
  */
 class CsvScenarioInterface {
  public:
@@ -74,4 +77,5 @@ class CsvScenarioInterface {
   static bool is_csv_senario_enabled_;                         //!< Enable flag to use CSV scenario
   static std::map<std::string, unsigned int> buffer_line_id_;  //!< Buffer line ID
   static std::map<std::string, DoubleBuffer> buffers_;         //!< Buffer
+  static std::shared_mutex buffer_mutex_;                      //!< Lock for the flag and the buffers
 };
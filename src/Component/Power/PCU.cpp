@@ -42,12 +42,10 @@ int PCU::ClosePort(const int port_id) {
   return 0;
 }
 
-std::string PCU::GetLogHeader() const {
-  std::string str_tmp = "";
-  return str_tmp;
+void PCU::GetLogSchema(LogSchema& schema) const {
+  UNUSED(schema);
 }
 
-std::string PCU::GetLogValue() const {
-  std::string str_tmp = "";
-  return str_tmp;
+void PCU::LogValues(LogSink& sink) const {
+  UNUSED(sink);
 }
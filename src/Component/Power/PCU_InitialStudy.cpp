@@ -34,18 +34,14 @@ PCU_InitialStudy::PCU_InitialStudy(ClockGenerator* clock_gen, const std::vector<
 
 PCU_InitialStudy::~PCU_InitialStudy() {}
 
-std::string PCU_InitialStudy::GetLogHeader() const {
-  std::string str_tmp = "";
-  str_tmp += WriteScalar("power_consumption", "W");
-  str_tmp += WriteScalar("bus_voltage", "V");
-  return str_tmp;
+void PCU_InitialStudy::GetLogSchema(LogSchema& schema) const {
+  schema.AddScalar("power_consumption", "W");
+  schema.AddScalar("bus_voltage", "V");
 }
 
-std::string PCU_InitialStudy::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteScalar(power_consumption_);
-  str_tmp += WriteScalar(bus_voltage_);
-  return str_tmp;
+void PCU_InitialStudy::LogValues(LogSink& sink) const {
+  sink.Add(power_consumption_);
+  sink.Add(bus_voltage_);
 }
 
 void PCU_InitialStudy::MainRoutine(int time_count) {
@@ -40,15 +40,15 @@ class PCU_InitialStudy : public ComponentBase, public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  std::string GetLogHeader() const override;
+  void GetLogSchema(LogSchema& schema) const override;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  std::string GetLogValue() const override;
+  void LogValues(LogSink& sink) const override;
 
  private:
   const std::vector<SAP*> saps_;    //!< Solar Array Panels
@@ -76,16 +76,12 @@ double SAP::GetPowerGeneration() const { return power_generation_; }
 
 void SAP::SetVoltage(const double voltage) { voltage_ = voltage; }
 
-std::string SAP::GetLogHeader() const {
-  std::string str_tmp = "";
-  str_tmp += WriteScalar("power_generation" + std::to_string(id_), "W");
-  return str_tmp;
+void SAP::GetLogSchema(LogSchema& schema) const {
+  schema.AddScalar("power_generation" + std::to_string(id_), "W");
 }
 
-std::string SAP::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteScalar(power_generation_);
-  return str_tmp;
+void SAP::LogValues(LogSink& sink) const {
+  sink.Add(power_generation_);
 }
 
 void SAP::MainRoutine(int time_count) {
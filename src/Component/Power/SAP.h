@@ -91,15 +91,15 @@ class SAP : public ComponentBase, public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  std::string GetLogHeader() const override;
+  void GetLogSchema(LogSchema& schema) const override;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  std::string GetLogValue() const override;
+  void LogValues(LogSink& sink) const override;
 
  private:
   const int id_;                          //!< SAP ID TODO: Use string?
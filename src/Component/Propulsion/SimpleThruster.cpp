@@ -71,24 +71,17 @@ void SimpleThruster::CalcTorque(Vector<3> center) {
   torque_b_ = torque;
 }
 
-std::string SimpleThruster::GetLogHeader() const {
-  std::string str_tmp = "";
-
+void SimpleThruster::GetLogSchema(LogSchema& schema) const {
   std::string head = "TH" + std::to_string(id_);
-  str_tmp += WriteVector(head + "thrust", "b", "N", 3);
-  str_tmp += WriteVector(head + "torque", "b", "Nm", 3);
-  str_tmp += WriteScalar(head + "thrust", "N");
-  return str_tmp;
+  schema.AddVector(head + "thrust", "b", "N", 3);
+  schema.AddVector(head + "torque", "b", "Nm", 3);
+  schema.AddScalar(head + "thrust", "N");
 }
 
-std::string SimpleThruster::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(thrust_b_);
-  str_tmp += WriteVector(torque_b_);
-  str_tmp += WriteScalar(norm(thrust_b_));
-
-  return str_tmp;
+void SimpleThruster::LogValues(LogSink& sink) const {
+  sink.Add(thrust_b_);
+  sink.Add(torque_b_);
+  sink.Add(norm(thrust_b_));
 }
 
 double SimpleThruster::CalcThrustMagnitude() { return duty_ * thrust_magnitude_max_; }
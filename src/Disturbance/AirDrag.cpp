@@ -84,20 +84,12 @@ void AirDrag::PrintParams(void)  // for debug
   cout << "Temperature =(" << Tw_ << "," << Tm_ << ") K \n";
 }
 
-string AirDrag::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector("airdrag_torque", "b", "Nm", 3);
-  str_tmp += WriteVector("airdrag_force", "b", "N", 3);
-
-  return str_tmp;
+void AirDrag::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("airdrag_torque", "b", "Nm", 3);
+  schema.AddVector("airdrag_force", "b", "N", 3);
 }
 
-string AirDrag::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector(torque_b_);
-  str_tmp += WriteVector(force_b_);
-
-  return str_tmp;
+void AirDrag::LogValues(LogSink& sink) const {
+  sink.Add(torque_b_);
+  sink.Add(force_b_);
 }
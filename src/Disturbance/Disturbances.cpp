@@ -53,10 +53,10 @@ void Disturbances::Update(const LocalEnvironment& local_env, const Dynamics& dyn
 
 void Disturbances::LogSetup(Logger& logger) {
   for (auto dist : disturbances_) {
-    logger.AddLoggable(dist);
+    logger.AddLoggable(dist, "disturbance");
   }
   for (auto acc_dist : acc_disturbances_) {
-    logger.AddLoggable(acc_dist);
+    logger.AddLoggable(acc_dist, "disturbance");
   }
   // Log ini file
   logger.CopyFileToLogDir(ini_fname_);
@@ -5,65 +5,34 @@
 
 #include "GeoPotential.h"
 
-#include <Environment/Global/PhysicalConstants.hpp>
 #include <chrono>
-#include <cmath>
-#include <fstream>
 #include <iostream>
+#if defined(GEOPOTENTIAL_AVX2_AVAILABLE) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
 
 #include "../Interface/LogOutput/LogUtility.h"
+#include "GeoPotentialRecursion.h"
 
 //#define DEBUG_GEOPOTENTIAL
 
 using namespace std;
+using namespace geopotential;
 
-GeoPotential::GeoPotential(const int degree, const string file_path) : degree_(degree) {
+GeoPotential::GeoPotential(const int degree, const string file_path) {
   // Initialize
   acc_ecef_ = Vector<3>(0);
   debug_pos_ecef_ = Vector<3>(0);
-  // degree
-  if (degree_ > 360) {
-    degree_ = 360;
-    cout << "Inputted degree of GeoPotential is too large for EGM96 "
-            "model(limit is 360)\n";
-    cout << "degree of GeoPotential set as " << degree_ << "\n";
-  } else if (degree_ <= 1) {
-    degree_ = 0;
-  }
   // coefficients
-  c_.assign(degree_ + 1, vector<double>(degree_ + 1, 0.0));
-  s_.assign(degree_ + 1, vector<double>(degree_ + 1, 0.0));
-  // For actual EGM model, c_[0][0] should be 1.0
-  // In S2E, 0 degree term is inside the SimpleCircularOrbit calculation
-  c_[0][0] = 0.0;
-  if (degree_ >= 2) {
-    if (!ReadCoefficientsEGM96(file_path)) {
-      degree_ = 0;
-      cout << "degree of GeoPotential set as " << degree_ << "\n";
-    }
-  }
-}
-
-bool GeoPotential::ReadCoefficientsEGM96(string file_name) {
-  ifstream coeff_file(file_name);
-  if (!coeff_file.is_open()) {
-    cerr << "file open error:Geopotential\n";
-    return false;
-  }
-
-  int num_coeff = ((degree_ + 1) * (degree_ + 2) / 2) - 3;  //-3 for C00,C10,C11
-  for (int i = 0; i < num_coeff; i++) {
-    int n_, m_;
-    double c_nm_norm, s_nm_norm;
-    string line;
-    getline(coeff_file, line);
-    istringstream streamline(line);
-    streamline >> n_ >> m_ >> c_nm_norm >> s_nm_norm;
-
-    c_[n_][m_] = c_nm_norm;
-    s_[n_][m_] = s_nm_norm;
-  }
-  return true;
+  coefficients_ = GeoPotentialCoefficients::Load(degree, file_path);
+  degree_ = coefficients_->GetDegree();
+  // Workspace: three rows of V and W
+  const int row_size = degree_ + 2;
+  v_.assign(3 * row_size, 0.0);
+  w_.assign(3 * row_size, 0.0);
+  // Kernel
+  if (IsKernelSupported(GeoPotentialKernel::Avx2)) kernel_ = GeoPotentialKernel::Avx2;
 }
 
 void GeoPotential::Update(const LocalEnvironment &local_env, const Dynamics &dynamics) {
@@ -84,131 +53,178 @@ void GeoPotential::Update(const LocalEnvironment &local_env, const Dynamics &dyn
   acceleration_i_ = trans_ecef2eci * acc_ecef_;
 }
 
+void GeoPotential::SetKernel(const GeoPotentialKernel kernel) {
+  if (!IsKernelSupported(kernel)) {
+    cerr << "Warning: the selected GeoPotential kernel is not supported by this CPU or build." << endl;
+    return;
+  }
+  kernel_ = kernel;
+}
+
+bool GeoPotential::IsKernelSupported(const GeoPotentialKernel kernel) {
+  if (kernel != GeoPotentialKernel::Avx2) return true;
+#if defined(GEOPOTENTIAL_AVX2_AVAILABLE) && defined(__GNUC__)
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#elif defined(GEOPOTENTIAL_AVX2_AVAILABLE) && defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 1);
+  const bool has_fma = (info[2] & (1 << 12)) != 0;
+  const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+  // The OS must save the YMM registers
+  if (!has_fma || !has_osxsave || (_xgetbv(0) & 6) != 6) return false;
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  return false;
+#endif
+}
+
+void GeoPotential::SetGridMethod(const double radius_step_m, const double angle_step_rad, const double tolerance_m_s2) {
+  method_ = GeoPotentialMethod::Grid;
+  grid_ = make_shared<GeoPotentialGrid>(radius_step_m, angle_step_rad, tolerance_m_s2);
+}
+
 void GeoPotential::CalcAccelerationECEF(const Vector<3> &position_ecef) {
-  x = position_ecef[0], y = position_ecef[1], z = position_ecef[2];
-  r = sqrt(x * x + y * y + z * z);
-
-  // Calc V and W
-  int degree_vw = degree_ + 1;
-  vector<vector<double>> v(degree_vw + 1, vector<double>(degree_vw + 1, 0.0));
-  vector<vector<double>> w(degree_vw + 1, vector<double>(degree_vw + 1, 0.0));
-  // n=m=0
-  v[0][0] = environment::earth_equatorial_radius_m / r;
-  w[0][0] = 0.0;
-  m = 0;
-
-  while (m < degree_vw) {
-    for (n = m + 1; n <= degree_vw; n++) {
-      if (n <= m + 1)
-        v_w_nm_update(&v[n][m], &w[n][m], v[n - 1][m], w[n - 1][m], 0.0, 0.0);
-      else
-        v_w_nm_update(&v[n][m], &w[n][m], v[n - 1][m], w[n - 1][m], v[n - 2][m], w[n - 2][m]);
-    }
-    // next step
-    m++;
-    n = m;
-    v_w_nn_update(&v[n][m], &w[n][m], v[n - 1][m - 1], w[n - 1][m - 1]);
+  if (method_ == GeoPotentialMethod::Grid) {
+    acc_ecef_ = grid_->CalcAccelerationECEF(
+        position_ecef, [this](const Vector<3> &position) { return CalcAccelerationECEFDirect(position); },
+        [this](const vector<Vector<3>> &positions, vector<Vector<3>> &accelerations) { CalcAccelerationECEF(positions, accelerations); });
+  } else {
+    acc_ecef_ = CalcAccelerationECEFDirect(position_ecef);
   }
+}
 
-  // Calc Acceleration
-  acc_ecef_ *= 0.0;
-  for (n = 0; n <= degree_; n++)  // this loop can integrate with previous loop
-  {
-    m = 0;
-    double n_d = (double)n;
-    double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
-    double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
-    // m==0
-    acc_ecef_[0] += -c_[n][0] * v[n + 1][1] * normalize_xy;
-    acc_ecef_[1] += -c_[n][0] * w[n + 1][1] * normalize_xy;
-    acc_ecef_[2] += (n + 1.0) * (-c_[n][0] * v[n + 1][0] - s_[n][0] * w[n + 1][0]) * normalize;
-    for (m = 1; m <= n; m++) {
-      double m_d = (double)m;
-      double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
-      double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
-      double normalize_xy2;
-      if (m == 1)
-        normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
-      else
-        normalize_xy2 = normalize * sqrt(factorial);
-      double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
-
-      acc_ecef_[0] += 0.5 * (normalize_xy1 * (-c_[n][m] * v[n + 1][m + 1] - s_[n][m] * w[n + 1][m + 1]) +
-                             normalize_xy2 * (c_[n][m] * v[n + 1][m - 1] + s_[n][m] * w[n + 1][m - 1]));
-      acc_ecef_[1] += 0.5 * (normalize_xy1 * (-c_[n][m] * w[n + 1][m + 1] + s_[n][m] * v[n + 1][m + 1]) +
-                             normalize_xy2 * (-c_[n][m] * w[n + 1][m - 1] + s_[n][m] * v[n + 1][m - 1]));
-      acc_ecef_[2] += (n_d - m_d + 1.0) * (-c_[n][m] * v[n + 1][m] - s_[n][m] * w[n + 1][m]) * normalize_z;
+Vector<3> GeoPotential::CalcAccelerationECEFDirect(const Vector<3> &position_ecef) {
+  switch (kernel_) {
+#ifdef GEOPOTENTIAL_AVX2_AVAILABLE
+    case GeoPotentialKernel::Avx2:
+      return CalcAccelerationECEFAvx2(position_ecef);
+#endif
+    case GeoPotentialKernel::Scalar:
+      return CalcAccelerationECEFScalar(position_ecef);
+    default:
+      return CalcAccelerationECEFPortable(position_ecef);
+  }
+}
+
+Vector<3> GeoPotential::CalcAccelerationECEFScalar(const Vector<3> &position_ecef) {
+  RecursionFactors<1> factors;
+  factors.Set(0, position_ecef);
+  VWRows<1> rows(&v_[0], &w_[0], degree_, factors);
+
+  double acc_x = 0.0, acc_y = 0.0, acc_z = 0.0;
+  for (int n = 1; n <= degree_ + 1; n++) {
+    rows.Calc(*coefficients_, n, factors);
+
+    // Calc Acceleration for degree n - 1
+    const int deg = n - 1;
+    const DegreeCoefficients d(*coefficients_, deg);
+    AddZeroOrderTerm<1>(d, rows.v_curr, rows.w_curr, acc_x, acc_y, acc_z);
+    for (int m = 1; m <= deg; m++) {
+      AddOrderTerm<1>(d, m, rows.v_curr, rows.w_curr, acc_x, acc_y, acc_z);
     }
+
+    rows.Next();
   }
-  acc_ecef_ *= environment::earth_gravitational_constant_m3_s2 / (environment::earth_equatorial_radius_m * environment::earth_equatorial_radius_m);
 
-  return;
+  return ScaleAcceleration(acc_x, acc_y, acc_z);
 }
 
-void GeoPotential::v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev) {
-  if (n != m) return;
+Vector<3> GeoPotential::CalcAccelerationECEFPortable(const Vector<3> &position_ecef) {
+  RecursionFactors<1> factors;
+  factors.Set(0, position_ecef);
+  VWRows<1> rows(&v_[0], &w_[0], degree_, factors);
+
+  // Independent accumulators for each lane so that the compiler can vectorize the summation over m
+  double acc_x[kNumLanes] = {}, acc_y[kNumLanes] = {}, acc_z[kNumLanes] = {};
+  for (int n = 1; n <= degree_ + 1; n++) {
+    rows.Calc(*coefficients_, n, factors);
+
+    // Calc Acceleration for degree n - 1
+    const int deg = n - 1;
+    const DegreeCoefficients d(*coefficients_, deg);
+    AddZeroOrderTerm<1>(d, rows.v_curr, rows.w_curr, acc_x[0], acc_y[0], acc_z[0]);
+    int m = 1;
+    for (; m + kNumLanes - 1 <= deg; m += kNumLanes) {
+      for (int l = 0; l < kNumLanes; l++) {
+        AddOrderTerm<1>(d, m + l, rows.v_curr, rows.w_curr, acc_x[l], acc_y[l], acc_z[l]);
+      }
+    }
+    for (; m <= deg; m++) {
+      AddOrderTerm<1>(d, m, rows.v_curr, rows.w_curr, acc_x[0], acc_y[0], acc_z[0]);
+    }
 
-  double n_d = (double)n;
+    rows.Next();
+  }
 
-  double tmp = environment::earth_equatorial_radius_m / (r * r);
-  double x_tmp = x * tmp;
-  double y_tmp = y * tmp;
-  double c_normalize;
-  if (n == 1)
-    c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
-  else
-    c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+  for (int l = 1; l < kNumLanes; l++) {
+    acc_x[0] += acc_x[l];
+    acc_y[0] += acc_y[l];
+    acc_z[0] += acc_z[l];
+  }
+  return ScaleAcceleration(acc_x[0], acc_y[0], acc_z[0]);
+}
 
-  *v_nn = c_normalize * (x_tmp * v_prev - y_tmp * w_prev);
-  *w_nn = c_normalize * (x_tmp * w_prev + y_tmp * v_prev);
-  return;
+void GeoPotential::CalcAccelerationECEF(const vector<Vector<3>> &positions_ecef, vector<Vector<3>> &accelerations_ecef) {
+  const int num = (int)positions_ecef.size();
+  accelerations_ecef.resize(num);
+  // The batch workspace is allocated only when the batch calculation is used
+  if (batch_v_.empty()) {
+    const int row_size = degree_ + 2;
+    batch_v_.assign(3 * row_size * kBatchSize, 0.0);
+    batch_w_.assign(3 * row_size * kBatchSize, 0.0);
+  }
+  for (int head = 0; head < num; head += kBatchSize) {
+    const int num_batch = num - head < kBatchSize ? num - head : kBatchSize;
+    CalcAccelerationECEFBatch(&positions_ecef[head], &accelerations_ecef[head], num_batch);
+  }
 }
 
-void GeoPotential::v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2) {
-  if (n == m) return;
+void GeoPotential::CalcAccelerationECEFBatch(const Vector<3> *positions_ecef, Vector<3> *accelerations_ecef, const int num) {
+  const int B = kBatchSize;
+  RecursionFactors<B> factors;
+  for (int k = 0; k < B; k++) {
+    // Unused lanes repeat the first position to keep the calculation finite
+    factors.Set(k, positions_ecef[k < num ? k : 0]);
+  }
+  VWRows<B> rows(&batch_v_[0], &batch_w_[0], degree_, factors);
 
-  double m_d = (double)m;
-  double n_d = (double)n;
+  double acc_x[B] = {}, acc_y[B] = {}, acc_z[B] = {};
+  for (int n = 1; n <= degree_ + 1; n++) {
+    rows.Calc(*coefficients_, n, factors);
 
-  double tmp = environment::earth_equatorial_radius_m / (r * r);
-  double z_tmp = z * tmp;
-  double re_tmp = environment::earth_equatorial_radius_m * tmp;
-  double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
-  double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
-  double c_normalize, c2_normalize;
+    // Calc Acceleration for degree n - 1
+    const int deg = n - 1;
+    const DegreeCoefficients d(*coefficients_, deg);
+    for (int k = 0; k < B; k++) {
+      AddZeroOrderTerm<B>(d, rows.v_curr + k, rows.w_curr + k, acc_x[k], acc_y[k], acc_z[k]);
+    }
+    for (int m = 1; m <= deg; m++) {
+      for (int k = 0; k < B; k++) {
+        AddOrderTerm<B>(d, m, rows.v_curr + k, rows.w_curr + k, acc_x[k], acc_y[k], acc_z[k]);
+      }
+    }
 
-  c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
-  if (n <= 1)
-    c2_normalize = 1.0;
-  else
-    c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+    rows.Next();
+  }
 
-  *v_nm = c_normalize * (c1 * z_tmp * v_prev - c2 * c2_normalize * re_tmp * v_prev2);
-  *w_nm = c_normalize * (c1 * z_tmp * w_prev - c2 * c2_normalize * re_tmp * w_prev2);
-  return;
+  for (int k = 0; k < num; k++) {
+    accelerations_ecef[k] = ScaleAcceleration(acc_x[k], acc_y[k], acc_z[k]);
+  }
 }
 
-string GeoPotential::GetLogHeader() const {
-  string str_tmp = "";
-
+void GeoPotential::GetLogSchema(LogSchema &schema) const {
 #ifdef DEBUG_GEOPOTENTIAL
-  str_tmp += WriteVector("pos_", "ecef", "m", 3);
-  str_tmp += WriteScalar("time_geop", "ms");
+  schema.AddVector("pos_", "ecef", "m", 3, 15);
+  schema.AddScalar("time_geop", "ms");
 #endif
-  str_tmp += WriteVector("a_geop", "ecef", "m/s2", 3);
-
-  return str_tmp;
+  schema.AddVector("a_geop", "ecef", "m/s2", 3, 15);
 }
 
-string GeoPotential::GetLogValue() const {
-  string str_tmp = "";
-
+void GeoPotential::LogValues(LogSink &sink) const {
 #ifdef DEBUG_GEOPOTENTIAL
-  str_tmp += WriteVector(debug_pos_ecef_, 15);
-  str_tmp += WriteScalar(time_);
+  sink.Add(debug_pos_ecef_);
+  sink.Add(time_);
 #endif
-
-  str_tmp += WriteVector(acc_ecef_, 15);
-
-  return str_tmp;
+  sink.Add(acc_ecef_);
 }
@@ -5,17 +5,45 @@
 
 #ifndef __GEOPOTENTIAL_H__
 #define __GEOPOTENTIAL_H__
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "../Interface/LogOutput/ILoggable.h"
 #include "../Library/math/MatVec.hpp"
 #include "../Library/math/Matrix.hpp"
 #include "../Library/math/Vector.hpp"
 #include "AccelerationDisturbance.h"
+#include "GeoPotentialCoefficients.h"
+#include "GeoPotentialGrid.h"
 
 using libra::Matrix;
 using libra::Vector;
 
+// The AVX2 kernel is compiled only for x86 targets. It is used only when the CPU supports AVX2 and FMA at run time.
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define GEOPOTENTIAL_AVX2_AVAILABLE
+#endif
+
+/**
+ * @enum GeoPotentialKernel
+ * @brief Implementation of the spherical harmonic synthesis
+ */
+enum class GeoPotentialKernel {
+  Scalar,    //!< Plain scalar loops used as the reference
+  Portable,  //!< Loops with independent lane accumulators vectorized by the compiler
+  Avx2,      //!< AVX2 and FMA intrinsics
+};
+
+/**
+ * @enum GeoPotentialMethod
+ * @brief Calculation method of the geo-potential acceleration
+ */
+enum class GeoPotentialMethod {
+  Direct,  //!< Spherical harmonic synthesis at every evaluation
+  Grid,    //!< Interpolation from a lazily filled spherical grid (see GeoPotentialGrid)
+};
+
 /**
  * @class GeoPotential
  * @brief Class to calculate the high-order earth gravity acceleration
@@ -36,15 +64,15 @@ class GeoPotential : public AccelerationDisturbance {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema &schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink &sink) const;
 
   /**
    * @fn CalcAccelerationECEF
@@ -54,32 +82,110 @@ class GeoPotential : public AccelerationDisturbance {
   void CalcAccelerationECEF(const Vector<3> &position_ecef);
 
   /**
-   * @fn ReadCoefficientsEGM96
-   * @brief Read the geo-potential coefficients for the EGM96 model
-   * @param [in] file_name: Coefficient file name
+   * @fn CalcAccelerationECEF
+   * @brief Calculate the high-order earth gravity in the ECEF frame for multiple spacecraft at once
+   * @note The calculated accelerations are returned through accelerations_ecef and do not overwrite the logged value of this instance.
+   *       The Grid method uses this function to fill the grid nodes of a new cell at once.
+   * @param [in] positions_ecef: Positions of the spacecraft in the ECEF fram [m]
+   * @param [out] accelerations_ecef: Calculated accelerations in the ECEF frame [m/s2]
+   */
+  void CalcAccelerationECEF(const std::vector<Vector<3>> &positions_ecef, std::vector<Vector<3>> &accelerations_ecef);
+
+  /**
+   * @fn SetGridMethod
+   * @brief Use the grid interpolation to calculate the acceleration
+   * @param [in] radius_step_m: Grid step of radius [m]
+   * @param [in] angle_step_rad: Grid step of latitude and longitude [rad]
+   * @param [in] tolerance_m_s2: Allowed interpolation error at the cell center [m/s2]
+   */
+  void SetGridMethod(const double radius_step_m, const double angle_step_rad, const double tolerance_m_s2);
+  /**
+   * @fn SetKernel
+   * @brief Select the implementation of the spherical harmonic synthesis. The fastest supported kernel is selected by default.
+   * @param [in] kernel: Kernel. The current kernel is kept when the kernel is not supported by the CPU.
+   */
+  void SetKernel(const GeoPotentialKernel kernel);
+  /**
+   * @fn IsKernelSupported
+   * @brief Return true when the kernel is compiled and supported by the CPU
+   * @param [in] kernel: Kernel
+   */
+  static bool IsKernelSupported(const GeoPotentialKernel kernel);
+
+  /**
+   * @fn GetKernel
+   * @brief Return the selected kernel
+   */
+  inline GeoPotentialKernel GetKernel() const { return kernel_; }
+  /**
+   * @fn GetAccelerationECEF
+   * @brief Return the acceleration in the ECEF frame calculated by the latest CalcAccelerationECEF(position_ecef) [m/s2]
+   */
+  inline const Vector<3> &GetAccelerationECEF() const { return acc_ecef_; }
+
+  /**
+   * @fn GetCoefficients
+   * @brief Return the coefficient tables shared with the other GeoPotential instances
    */
-  bool ReadCoefficientsEGM96(std::string file_name);
+  inline const GeoPotentialCoefficients &GetCoefficients() const { return *coefficients_; }
 
  private:
-  int degree_;                //!< Maximum degree setting to calculate the geo-potential
-  vector<vector<double>> c_;  //!< Cosine coefficients
-  vector<vector<double>> s_;  //!< Sine coefficients
-  Vector<3> acc_ecef_;        //!< Calculated acceleration in the ECEF frame [m/s2]
-  // calculation
-  double r = 0.0;                    //!< Radius [m]
-  double x = 0.0, y = 0.0, z = 0.0;  //!< Spacecraft position in ECEF frame [m]
-  int n = 0, m = 0;                  //!< Degree and order
+  int degree_;                                                    //!< Maximum degree setting to calculate the geo-potential
+  std::shared_ptr<const GeoPotentialCoefficients> coefficients_;  //!< Coefficient tables shared between instances
+  Vector<3> acc_ecef_;                                            //!< Calculated acceleration in the ECEF frame [m/s2]
+
+  GeoPotentialMethod method_ = GeoPotentialMethod::Direct;    //!< Calculation method
+  GeoPotentialKernel kernel_ = GeoPotentialKernel::Portable;  //!< Implementation of the spherical harmonic synthesis
+  std::shared_ptr<GeoPotentialGrid> grid_;                    //!< Grid cache used in the Grid method
+
+  // Workspace
+  vector<double> v_;        //!< Last three rows (n-2, n-1, n) of the V function
+  vector<double> w_;        //!< Last three rows (n-2, n-1, n) of the W function
+  vector<double> batch_v_;  //!< Last three rows of the V function for kBatchSize spacecraft (structure of arrays, allocated at the first use)
+  vector<double> batch_w_;  //!< Last three rows of the W function for kBatchSize spacecraft (structure of arrays, allocated at the first use)
+
+  static const int kNumLanes = 4;   //!< Number of independent accumulators used in the summation over the order m
+  static const int kBatchSize = 8;  //!< Number of spacecraft calculated together in the batch calculation
 
   /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
+   * @fn CalcAccelerationECEFDirect
+   * @brief Calculate the high-order earth gravity in the ECEF frame with the spherical harmonic synthesis
+   * @param [in] position_ecef: Position of the spacecraft in the ECEF fram [m]
+   * @return Acceleration in the ECEF frame [m/s2]
+   */
+  Vector<3> CalcAccelerationECEFDirect(const Vector<3> &position_ecef);
+  /**
+   * @fn CalcAccelerationECEFScalar
+   * @brief Reference implementation of CalcAccelerationECEFDirect with plain scalar loops
+   * @param [in] position_ecef: Position of the spacecraft in the ECEF fram [m]
+   * @return Acceleration in the ECEF frame [m/s2]
+   */
+  Vector<3> CalcAccelerationECEFScalar(const Vector<3> &position_ecef);
+  /**
+   * @fn CalcAccelerationECEFPortable
+   * @brief Implementation of CalcAccelerationECEFDirect with independent lane accumulators over the order m
+   * @param [in] position_ecef: Position of the spacecraft in the ECEF fram [m]
+   * @return Acceleration in the ECEF frame [m/s2]
+   */
+  Vector<3> CalcAccelerationECEFPortable(const Vector<3> &position_ecef);
+#ifdef GEOPOTENTIAL_AVX2_AVAILABLE
+  /**
+   * @fn CalcAccelerationECEFAvx2
+   * @brief Implementation of CalcAccelerationECEFDirect with AVX2 and FMA intrinsics (4 lanes over the order m)
+   * @note Defined in GeoPotentialAvx2.cpp. Call it only when IsKernelSupported(GeoPotentialKernel::Avx2) is true.
+   * @param [in] position_ecef: Position of the spacecraft in the ECEF fram [m]
+   * @return Acceleration in the ECEF frame [m/s2]
    */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
+  Vector<3> CalcAccelerationECEFAvx2(const Vector<3> &position_ecef);
+#endif
   /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
+   * @fn CalcAccelerationECEFBatch
+   * @brief Calculate the high-order earth gravity in the ECEF frame for up to kBatchSize spacecraft
+   * @param [in] positions_ecef: Head pointer of the positions of the spacecraft in the ECEF fram [m]
+   * @param [out] accelerations_ecef: Head pointer of the calculated accelerations in the ECEF frame [m/s2]
+   * @param [in] num: Number of spacecraft (<= kBatchSize)
    */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+  void CalcAccelerationECEFBatch(const Vector<3> *positions_ecef, Vector<3> *accelerations_ecef, const int num);
 
   // debug
   Vector<3> debug_pos_ecef_;  //!< Spacecraft position in ECEF frame [m]
@@ -0,0 +1,76 @@
+/**
+ * @file GeoPotentialAvx2.cpp
+ * @brief AVX2 kernel of the spherical harmonic synthesis of GeoPotential
+ * @note The functions in this file are compiled for AVX2 and FMA regardless of the build target, and GeoPotential calls them only
+ *       when the CPU supports the instructions.
+ */
+
+#include "GeoPotential.h"
+
+#ifdef GEOPOTENTIAL_AVX2_AVAILABLE
+
+#include <immintrin.h>
+
+#include "GeoPotentialRecursion.h"
+
+#if defined(__GNUC__)
+#define GEOPOTENTIAL_AVX2_TARGET __attribute__((target("avx2,fma")))
+#else
+#define GEOPOTENTIAL_AVX2_TARGET
+#endif
+
+using namespace geopotential;
+
+/**
+ * @fn HorizontalSum
+ * @brief Return sum of the four lanes
+ */
+GEOPOTENTIAL_AVX2_TARGET static inline double HorizontalSum(const __m256d x) {
+  const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+GEOPOTENTIAL_AVX2_TARGET Vector<3> GeoPotential::CalcAccelerationECEFAvx2(const Vector<3> &position_ecef) {
+  RecursionFactors<1> factors;
+  factors.Set(0, position_ecef);
+  VWRows<1> rows(&v_[0], &w_[0], degree_, factors);
+
+  __m256d acc_x4 = _mm256_setzero_pd(), acc_y4 = _mm256_setzero_pd(), acc_z4 = _mm256_setzero_pd();
+  double acc_x = 0.0, acc_y = 0.0, acc_z = 0.0;
+  for (int n = 1; n <= degree_ + 1; n++) {
+    rows.Calc(*coefficients_, n, factors);
+
+    // Calc Acceleration for degree n - 1
+    const int deg = n - 1;
+    const DegreeCoefficients d(*coefficients_, deg);
+    const double *v = rows.v_curr;
+    const double *w = rows.w_curr;
+    AddZeroOrderTerm<1>(d, v, w, acc_x, acc_y, acc_z);
+    int m = 1;
+    for (; m + 3 <= deg; m += 4) {
+      const __m256d c4 = _mm256_loadu_pd(d.c + m);
+      const __m256d s4 = _mm256_loadu_pd(d.s + m);
+      const __m256d vp = _mm256_loadu_pd(v + m + 1), v0 = _mm256_loadu_pd(v + m), vm = _mm256_loadu_pd(v + m - 1);
+      const __m256d wp = _mm256_loadu_pd(w + m + 1), w0 = _mm256_loadu_pd(w + m), wm = _mm256_loadu_pd(w + m - 1);
+      const __m256d xy1_4 = _mm256_loadu_pd(d.xy1 + m);
+      const __m256d xy2_4 = _mm256_loadu_pd(d.xy2 + m);
+      // x: xy1 * (-c * vp - s * wp) + xy2 * (c * vm + s * wm)
+      acc_x4 = _mm256_fnmadd_pd(xy1_4, _mm256_fmadd_pd(c4, vp, _mm256_mul_pd(s4, wp)), acc_x4);
+      acc_x4 = _mm256_fmadd_pd(xy2_4, _mm256_fmadd_pd(c4, vm, _mm256_mul_pd(s4, wm)), acc_x4);
+      // y: xy1 * (-c * wp + s * vp) + xy2 * (-c * wm + s * vm)
+      acc_y4 = _mm256_fmadd_pd(xy1_4, _mm256_fmsub_pd(s4, vp, _mm256_mul_pd(c4, wp)), acc_y4);
+      acc_y4 = _mm256_fmadd_pd(xy2_4, _mm256_fmsub_pd(s4, vm, _mm256_mul_pd(c4, wm)), acc_y4);
+      // z: (-c * v0 - s * w0) * nz
+      acc_z4 = _mm256_fnmadd_pd(_mm256_fmadd_pd(c4, v0, _mm256_mul_pd(s4, w0)), _mm256_loadu_pd(d.nz + m), acc_z4);
+    }
+    for (; m <= deg; m++) {
+      AddOrderTerm<1>(d, m, v, w, acc_x, acc_y, acc_z);
+    }
+
+    rows.Next();
+  }
+
+  return ScaleAcceleration(acc_x + HorizontalSum(acc_x4), acc_y + HorizontalSum(acc_y4), acc_z + HorizontalSum(acc_z4));
+}
+
+#endif  // GEOPOTENTIAL_AVX2_AVAILABLE
@@ -0,0 +1,233 @@
+/**
+ * @file GeoPotentialCoefficients.cpp
+ * @brief Immutable geo-potential coefficient tables shared between GeoPotential instances
+ */
+
+#include "GeoPotentialCoefficients.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace std;
+
+map<pair<string, int>, shared_ptr<const GeoPotentialCoefficients>> GeoPotentialCoefficients::loaded_;
+mutex GeoPotentialCoefficients::loaded_mutex_;
+const char GeoPotentialCoefficients::kBinaryCacheMagic[8] = {'S', '2', 'E', 'G', 'E', 'O', 'P', '\0'};
+
+GeoPotentialCoefficients::GeoPotentialCoefficients(const int degree, const string file_path) : degree_(degree) {
+  // degree
+  if (degree_ > kMaxDegree) {
+    degree_ = kMaxDegree;
+    cout << "Inputted degree of GeoPotential is too large for EGM96 "
+            "model(limit is 360)\n";
+    cout << "degree of GeoPotential set as " << degree_ << "\n";
+  } else if (degree_ <= 1) {
+    degree_ = 0;
+  }
+  // coefficients
+  c_.assign(TriangularIndex(degree_ + 1, 0), 0.0);
+  s_.assign(TriangularIndex(degree_ + 1, 0), 0.0);
+  // For actual EGM model, c_[0][0] should be 1.0
+  // In S2E, 0 degree term is inside the SimpleCircularOrbit calculation
+  c_[TriangularIndex(0, 0)] = 0.0;
+  if (degree_ >= 2) {
+    if (!ReadCoefficientsEGM96(file_path)) {
+      degree_ = 0;
+      cout << "degree of GeoPotential set as " << degree_ << "\n";
+    }
+  }
+  InitializeTables();
+}
+
+shared_ptr<const GeoPotentialCoefficients> GeoPotentialCoefficients::Load(const int degree, const string file_path) {
+  lock_guard<mutex> lock(loaded_mutex_);
+  auto key = make_pair(file_path, degree);
+  auto itr = loaded_.find(key);
+  if (itr != loaded_.end()) return itr->second;
+
+  auto coefficients = make_shared<const GeoPotentialCoefficients>(degree, file_path);
+  loaded_[key] = coefficients;
+  return coefficients;
+}
+
+bool GeoPotentialCoefficients::ReadCoefficientsEGM96(string file_name) {
+  struct stat source_stat;
+  if (stat(file_name.c_str(), &source_stat) != 0) {
+    cerr << "file open error:Geopotential\n";
+    return false;
+  }
+  SourceStamp source;
+  source.size = (uint64_t)source_stat.st_size;
+  source.mtime = (int64_t)source_stat.st_mtime;
+
+  // Use the binary cache when it was generated from the same source file
+  const string cache_file_name = file_name + ".bin";
+  if (ReadBinaryCache(cache_file_name, source)) return true;
+
+  ifstream coeff_stream(file_name);
+  if (!coeff_stream.is_open()) {
+    cerr << "file open error:Geopotential\n";
+    return false;
+  }
+  int num_coeff = ((degree_ + 1) * (degree_ + 2) / 2) - 3;  //-3 for C00,C10,C11
+  for (int i = 0; i < num_coeff; i++) {
+    int n_, m_;
+    double c_nm_norm, s_nm_norm;
+    string line;
+    getline(coeff_stream, line);
+    istringstream streamline(line);
+    streamline >> n_ >> m_ >> c_nm_norm >> s_nm_norm;
+
+    c_[TriangularIndex(n_, m_)] = c_nm_norm;
+    s_[TriangularIndex(n_, m_)] = s_nm_norm;
+  }
+
+  WriteBinaryCache(cache_file_name, source);
+  return true;
+}
+
+bool GeoPotentialCoefficients::ReadBinaryCache(const string file_name, const SourceStamp& source) {
+  ifstream cache_file(file_name, ios::binary | ios::ate);
+  if (!cache_file.is_open()) return false;
+  const streamoff file_size = cache_file.tellg();
+  cache_file.seekg(0);
+
+  BinaryCacheHeader header;
+  cache_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!cache_file || memcmp(header.magic, kBinaryCacheMagic, sizeof(header.magic)) != 0) return false;
+  if (header.version != kBinaryCacheVersion || header.source_size != source.size || header.source_mtime != source.mtime) return false;
+  // The cache generated for a higher degree contains the lower degree coefficients at the head of the tables
+  if (header.degree < degree_ || header.degree > kMaxDegree) return false;
+  // Check the size before allocating the tables to reject truncated or corrupted caches
+  const size_t num_cached = TriangularIndex(header.degree + 1, 0);
+  if (file_size != (streamoff)(sizeof(header) + 2 * num_cached * sizeof(double))) return false;
+
+  vector<double> c_cached(num_cached), s_cached(num_cached);
+  cache_file.read(reinterpret_cast<char*>(c_cached.data()), num_cached * sizeof(double));
+  cache_file.read(reinterpret_cast<char*>(s_cached.data()), num_cached * sizeof(double));
+  if (!cache_file) return false;
+  uint64_t checksum = CalcHash(c_cached.data(), num_cached * sizeof(double));
+  checksum = CalcHash(s_cached.data(), num_cached * sizeof(double), checksum);
+  if (checksum != header.checksum) return false;
+
+  const size_t num = c_.size();
+  copy(c_cached.begin(), c_cached.begin() + num, c_.begin());
+  copy(s_cached.begin(), s_cached.begin() + num, s_.begin());
+  return true;
+}
+
+void GeoPotentialCoefficients::WriteBinaryCache(const string file_name, const SourceStamp& source) const {
+  // Unique temporary file name in the same directory to rename it atomically
+  const uint64_t suffix = (uint64_t)random_device()() ^ (uint64_t)chrono::steady_clock::now().time_since_epoch().count();
+  const string temp_file_name = file_name + ".tmp" + to_string(suffix);
+  ofstream cache_file(temp_file_name, ios::binary | ios::trunc);
+  if (!cache_file.is_open()) {
+    cerr << "Warning: binary cache of GeoPotential cannot be written to " << file_name << "\n";
+    return;
+  }
+
+  BinaryCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kBinaryCacheMagic, sizeof(header.magic));
+  header.version = kBinaryCacheVersion;
+  header.degree = degree_;
+  header.source_size = source.size;
+  header.source_mtime = source.mtime;
+  header.checksum = CalcHash(c_.data(), c_.size() * sizeof(double));
+  header.checksum = CalcHash(s_.data(), s_.size() * sizeof(double), header.checksum);
+
+  cache_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  cache_file.write(reinterpret_cast<const char*>(c_.data()), c_.size() * sizeof(double));
+  cache_file.write(reinterpret_cast<const char*>(s_.data()), s_.size() * sizeof(double));
+  cache_file.close();
+  if (!cache_file) {
+    cerr << "Warning: binary cache of GeoPotential cannot be written to " << file_name << "\n";
+    remove(temp_file_name.c_str());
+    return;
+  }
+
+  // rename does not replace an existing file on Windows
+  if (rename(temp_file_name.c_str(), file_name.c_str()) != 0) {
+    remove(file_name.c_str());
+    if (rename(temp_file_name.c_str(), file_name.c_str()) != 0) remove(temp_file_name.c_str());
+  }
+}
+
+uint64_t GeoPotentialCoefficients::CalcHash(const void* data, const size_t size, const uint64_t seed) {
+  // FNV-1a
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  uint64_t hash = seed;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+void GeoPotentialCoefficients::InitializeTables() {
+  const int degree_vw = degree_ + 1;
+  const int num_vw = TriangularIndex(degree_vw + 1, 0);
+  const int num_acc = TriangularIndex(degree_ + 1, 0);
+
+  // V and W recursion
+  vw_nn_coeff_.assign(degree_vw + 1, 0.0);
+  vw_nm_coeff1_.assign(num_vw, 0.0);
+  vw_nm_coeff2_.assign(num_vw, 0.0);
+  for (int n = 1; n <= degree_vw; n++) {
+    double n_d = (double)n;
+    if (n == 1)
+      vw_nn_coeff_[n] = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+    else
+      vw_nn_coeff_[n] = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+
+    for (int m = 0; m < n; m++) {
+      double m_d = (double)m;
+      double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize;
+      if (n <= 1)
+        c2_normalize = 1.0;
+      else
+        c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+
+      vw_nm_coeff1_[TriangularIndex(n, m)] = c_normalize * c1;
+      // V(n-2,m) and W(n-2,m) do not exist for n = m + 1
+      if (n > m + 1) vw_nm_coeff2_[TriangularIndex(n, m)] = c_normalize * c2 * c2_normalize;
+    }
+  }
+
+  // Acceleration (the factor 0.5 of the x-y terms is included in acc_xy1_ and acc_xy2_)
+  acc_xy1_.assign(num_acc, 0.0);
+  acc_xy2_.assign(num_acc, 0.0);
+  acc_z_.assign(num_acc, 0.0);
+  for (int n = 0; n <= degree_; n++) {
+    double n_d = (double)n;
+    double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+    // m==0
+    acc_xy1_[TriangularIndex(n, 0)] = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    acc_z_[TriangularIndex(n, 0)] = (n_d + 1.0) * normalize;
+    for (int m = 1; m <= n; m++) {
+      double m_d = (double)m;
+      double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+      double normalize_xy2;
+      if (m == 1)
+        normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
+      else
+        normalize_xy2 = normalize * sqrt(factorial);
+
+      acc_xy1_[TriangularIndex(n, m)] = 0.5 * normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+      acc_xy2_[TriangularIndex(n, m)] = 0.5 * normalize_xy2;
+      acc_z_[TriangularIndex(n, m)] = (n_d - m_d + 1.0) * normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+    }
+  }
+}
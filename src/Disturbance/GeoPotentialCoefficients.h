@@ -0,0 +1,177 @@
+/**
+ * @file GeoPotentialCoefficients.h
+ * @brief Immutable geo-potential coefficient tables shared between GeoPotential instances
+ */
+
+#ifndef __GEOPOTENTIAL_COEFFICIENTS_H__
+#define __GEOPOTENTIAL_COEFFICIENTS_H__
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class GeoPotentialCoefficients
+ * @brief Immutable geo-potential coefficients and precomputed normalization factors
+ * @note All tables are stored as flat lower triangles. Use TriangularIndex to access the (n, m) element.
+ * @note The coefficients read from a text file are also saved as a binary cache (<file_path>.bin) which is used in the following runs.
+ *       The cache is a fixed size header (BinaryCacheHeader) followed by the raw C and S tables, and it is discarded when the size or the
+ *       modification time of the source file changes.
+ */
+class GeoPotentialCoefficients {
+ public:
+  /**
+   * @fn GeoPotentialCoefficients
+   * @brief Constructor
+   * @param [in] degree: Maximum degree setting to calculate the geo-potential
+   * @param [in] file_path: Path to the EGM96 coefficient file
+   */
+  GeoPotentialCoefficients(const int degree, const std::string file_path);
+
+  /**
+   * @fn Load
+   * @brief Return the coefficient tables for the degree and the file
+   * @note The tables are read only once per process and shared between all callers
+   * @param [in] degree: Maximum degree setting to calculate the geo-potential
+   * @param [in] file_path: Path to the EGM96 coefficient file
+   */
+  static std::shared_ptr<const GeoPotentialCoefficients> Load(const int degree, const std::string file_path);
+
+  /**
+   * @fn TriangularIndex
+   * @brief Index of the (n, m) element in the flat lower triangular tables
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  static inline int TriangularIndex(const int n, const int m) { return n * (n + 1) / 2 + m; }
+
+  // Getter
+  /**
+   * @fn GetDegree
+   * @brief Return maximum degree of the loaded coefficients
+   */
+  inline int GetDegree() const { return degree_; }
+  /**
+   * @fn GetC
+   * @brief Return head pointer of the cosine coefficients of degree n
+   */
+  inline const double* GetC(const int n) const { return &c_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetS
+   * @brief Return head pointer of the sine coefficients of degree n
+   */
+  inline const double* GetS(const int n) const { return &s_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetVWnnCoeff
+   * @brief Return coefficient for the sectoral (n = m) V and W recursion
+   */
+  inline double GetVWnnCoeff(const int n) const { return vw_nn_coeff_[n]; }
+  /**
+   * @fn GetVWnmCoeff1
+   * @brief Return head pointer of the coefficients multiplied to V(n-1,m) and W(n-1,m) in the n != m recursion
+   */
+  inline const double* GetVWnmCoeff1(const int n) const { return &vw_nm_coeff1_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetVWnmCoeff2
+   * @brief Return head pointer of the coefficients multiplied to V(n-2,m) and W(n-2,m) in the n != m recursion
+   */
+  inline const double* GetVWnmCoeff2(const int n) const { return &vw_nm_coeff2_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetAccXY1
+   * @brief Return head pointer of the normalization factors for the V(n+1,m+1) and W(n+1,m+1) terms in the x-y acceleration
+   */
+  inline const double* GetAccXY1(const int n) const { return &acc_xy1_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetAccXY2
+   * @brief Return head pointer of the normalization factors for the V(n+1,m-1) and W(n+1,m-1) terms in the x-y acceleration
+   */
+  inline const double* GetAccXY2(const int n) const { return &acc_xy2_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetAccZ
+   * @brief Return head pointer of the normalization factors for the V(n+1,m) and W(n+1,m) terms in the z acceleration
+   */
+  inline const double* GetAccZ(const int n) const { return &acc_z_[TriangularIndex(n, 0)]; }
+
+ private:
+  int degree_;             //!< Maximum degree setting to calculate the geo-potential
+  std::vector<double> c_;  //!< Cosine coefficients
+  std::vector<double> s_;  //!< Sine coefficients
+
+  // Precomputed normalization factors
+  std::vector<double> vw_nn_coeff_;   //!< Coefficients for the sectoral (n = m) V and W recursion
+  std::vector<double> vw_nm_coeff1_;  //!< Coefficients multiplied to V(n-1,m) and W(n-1,m) in the n != m recursion
+  std::vector<double> vw_nm_coeff2_;  //!< Coefficients multiplied to V(n-2,m) and W(n-2,m) in the n != m recursion
+  std::vector<double> acc_xy1_;       //!< Normalization factors for the V(n+1,m+1) and W(n+1,m+1) terms in the x-y acceleration
+  std::vector<double> acc_xy2_;       //!< Normalization factors for the V(n+1,m-1) and W(n+1,m-1) terms in the x-y acceleration
+  std::vector<double> acc_z_;         //!< Normalization factors for the V(n+1,m) and W(n+1,m) terms in the z acceleration
+
+  static std::map<std::pair<std::string, int>, std::shared_ptr<const GeoPotentialCoefficients>> loaded_;  //!< Loaded coefficient tables
+  static std::mutex loaded_mutex_;                                                                        //!< Mutex for loaded_
+
+  /**
+   * @struct BinaryCacheHeader
+   * @brief Header of the binary coefficient cache
+   */
+  struct BinaryCacheHeader {
+    char magic[8];         //!< File identifier
+    uint32_t version;      //!< Format version
+    int32_t degree;        //!< Maximum degree stored in the cache
+    uint64_t source_size;  //!< Size of the source text file [byte]
+    int64_t source_mtime;  //!< Modification time of the source text file [s]
+    uint64_t checksum;     //!< Checksum of the C and S tables
+  };
+  /**
+   * @struct SourceStamp
+   * @brief Size and modification time to detect the change of the source text file without reading it
+   */
+  struct SourceStamp {
+    uint64_t size;  //!< Size of the source text file [byte]
+    int64_t mtime;  //!< Modification time of the source text file [s]
+  };
+  static const char kBinaryCacheMagic[8];         //!< File identifier of the binary cache
+  static const uint32_t kBinaryCacheVersion = 2;  //!< Format version of the binary cache
+  static const int kMaxDegree = 360;              //!< Maximum degree of the EGM96 model
+
+  /**
+   * @fn ReadCoefficientsEGM96
+   * @brief Read the geo-potential coefficients for the EGM96 model
+   * @param [in] file_name: Coefficient file name
+   */
+  bool ReadCoefficientsEGM96(std::string file_name);
+  /**
+   * @fn ReadBinaryCache
+   * @brief Read the coefficients from the binary cache
+   * @param [in] file_name: Binary cache file name
+   * @param [in] source: Stamp of the source text file
+   * @return True when a valid cache for the source file is found
+   */
+  bool ReadBinaryCache(const std::string file_name, const SourceStamp& source);
+  /**
+   * @fn WriteBinaryCache
+   * @brief Write the coefficients to the binary cache
+   * @note The cache is written to a temporary file in the same directory and renamed to file_name,
+   *       so readers never see a partially written cache even when several processes write it at the same time.
+   * @param [in] file_name: Binary cache file name
+   * @param [in] source: Stamp of the source text file
+   */
+  void WriteBinaryCache(const std::string file_name, const SourceStamp& source) const;
+  /**
+   * @fn CalcHash
+   * @brief Calculate 64bit FNV-1a hash
+   * @param [in] data: Head pointer of the data
+   * @param [in] size: Size of the data [byte]
+   * @param [in] seed: Initial value to continue the hash of the previous data
+   */
+  static uint64_t CalcHash(const void* data, const size_t size, const uint64_t seed = 0xcbf29ce484222325ULL);
+  /**
+   * @fn InitializeTables
+   * @brief Precompute the normalization factors for the current degree
+   */
+  void InitializeTables();
+};
+
+#endif  //__GEOPOTENTIAL_COEFFICIENTS_H__
@@ -0,0 +1,138 @@
+/**
+ * @file GeoPotentialGrid.cpp
+ * @brief Lazily filled spherical grid cache of the geo-potential acceleration
+ */
+
+#include "GeoPotentialGrid.h"
+
+#include <Library/math/Constant.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+GeoPotentialGrid::GeoPotentialGrid(const double radius_step_m, const double angle_step_rad, const double tolerance_m_s2)
+    : radius_step_m_(radius_step_m), lat_step_rad_(angle_step_rad), tolerance_m_s2_(tolerance_m_s2) {
+  // Longitude step is adjusted to divide the full circle
+  num_lon_ = (int)ceil(libra::tau / angle_step_rad - 1e-9);
+  lon_step_rad_ = libra::tau / num_lon_;
+}
+
+Vector<3> GeoPotentialGrid::CalcAccelerationECEF(const Vector<3>& position_ecef, const function<Vector<3>(const Vector<3>&)>& calc_direct,
+                                                  const function<void(const vector<Vector<3>>&, vector<Vector<3>>&)>& calc_direct_batch) {
+  const double r = norm(position_ecef);
+  const double f_r = r / radius_step_m_;
+  // Too close to the center to place the grid
+  if (f_r < 2.0) return calc_direct(position_ecef);
+  const double f_lat = asin(position_ecef[2] / r) / lat_step_rad_;
+  const double f_lon = atan2(position_ecef[1], position_ecef[0]) / lon_step_rad_;
+  const int i_r = (int)floor(f_r);
+  const int i_lat = (int)floor(f_lat);
+  const int i_lon = (int)floor(f_lon);
+
+  const uint64_t cell_key = CalcKey(i_r, i_lat, i_lon);
+  if (!is_last_cell_set_ || cell_key != last_cell_key_) {
+    last_cell_key_ = cell_key;
+    is_last_cell_set_ = true;
+
+    auto itr = cells_.find(cell_key);
+    if (itr != cells_.end() && !itr->second) {
+      is_last_cell_valid_ = false;
+    } else {
+      SetCellNodes(i_r, i_lat, i_lon, calc_direct_batch);
+      if (itr != cells_.end()) {
+        is_last_cell_valid_ = true;
+      } else {
+        // Check the interpolation error at the center of the cell
+        const double r_c = (i_r + 0.5) * radius_step_m_;
+        const double lat_c = (i_lat + 0.5) * lat_step_rad_;
+        const double lon_c = (i_lon + 0.5) * lon_step_rad_;
+        Vector<3> position_c;
+        position_c[0] = r_c * cos(lat_c) * cos(lon_c);
+        position_c[1] = r_c * cos(lat_c) * sin(lon_c);
+        position_c[2] = r_c * sin(lat_c);
+        Vector<3> error = calc_direct(position_c) - Interpolate(0.5, 0.5, 0.5);
+        is_last_cell_valid_ = norm(error) <= tolerance_m_s2_;
+        cells_[cell_key] = is_last_cell_valid_;
+        if (!is_last_cell_valid_) num_direct_cells_++;
+      }
+    }
+  }
+
+  if (!is_last_cell_valid_) return calc_direct(position_ecef);
+  return Interpolate(f_r - i_r, f_lat - i_lat, f_lon - i_lon);
+}
+
+uint64_t GeoPotentialGrid::CalcKey(const int i_r, const int i_lat, const int i_lon) const {
+  // 24bit for radius, 20bit for latitude, and 20bit for longitude
+  const uint64_t key_r = (uint64_t)i_r & 0xffffff;
+  const uint64_t key_lat = (uint64_t)(i_lat + (1 << 19)) & 0xfffff;
+  const uint64_t key_lon = (uint64_t)(((i_lon % num_lon_) + num_lon_) % num_lon_) & 0xfffff;
+  return (key_r << 40) | (key_lat << 20) | key_lon;
+}
+
+void GeoPotentialGrid::SetCellNodes(const int i_r, const int i_lat, const int i_lon,
+                                    const function<void(const vector<Vector<3>>&, vector<Vector<3>>&)>& calc_direct_batch) {
+  // Collect the nodes not calculated yet
+  missing_keys_.clear();
+  missing_positions_.clear();
+  for (int a = 0; a < 4; a++) {
+    for (int b = 0; b < 4; b++) {
+      for (int c = 0; c < 4; c++) {
+        const uint64_t key = CalcKey(i_r - 1 + a, i_lat - 1 + b, i_lon - 1 + c);
+        // The same node can appear twice when the longitude wraps around
+        if (nodes_.count(key) > 0 || find(missing_keys_.begin(), missing_keys_.end(), key) != missing_keys_.end()) continue;
+        // Nodes beyond the poles are also calculated at their actual positions
+        const double r = (i_r - 1 + a) * radius_step_m_;
+        const double lat = (i_lat - 1 + b) * lat_step_rad_;
+        const double lon = (i_lon - 1 + c) * lon_step_rad_;
+        Vector<3> position_ecef;
+        position_ecef[0] = r * cos(lat) * cos(lon);
+        position_ecef[1] = r * cos(lat) * sin(lon);
+        position_ecef[2] = r * sin(lat);
+        missing_keys_.push_back(key);
+        missing_positions_.push_back(position_ecef);
+      }
+    }
+  }
+
+  if (!missing_keys_.empty()) {
+    calc_direct_batch(missing_positions_, missing_accelerations_);
+    for (size_t i = 0; i < missing_keys_.size(); i++) nodes_.emplace(missing_keys_[i], missing_accelerations_[i]);
+  }
+
+  for (int a = 0; a < 4; a++) {
+    for (int b = 0; b < 4; b++) {
+      for (int c = 0; c < 4; c++) {
+        last_cell_nodes_[(a * 4 + b) * 4 + c] = nodes_.at(CalcKey(i_r - 1 + a, i_lat - 1 + b, i_lon - 1 + c));
+      }
+    }
+  }
+}
+
+Vector<3> GeoPotentialGrid::Interpolate(const double t_r, const double t_lat, const double t_lon) const {
+  // Weights of the cubic Lagrange interpolation with the nodes at -1, 0, 1, and 2
+  double w[3][4];
+  const double t[3] = {t_r, t_lat, t_lon};
+  for (int i = 0; i < 3; i++) {
+    w[i][0] = -t[i] * (t[i] - 1.0) * (t[i] - 2.0) / 6.0;
+    w[i][1] = (t[i] + 1.0) * (t[i] - 1.0) * (t[i] - 2.0) / 2.0;
+    w[i][2] = -(t[i] + 1.0) * t[i] * (t[i] - 2.0) / 2.0;
+    w[i][3] = (t[i] + 1.0) * t[i] * (t[i] - 1.0) / 6.0;
+  }
+
+  Vector<3> acc_ecef(0.0);
+  for (int a = 0; a < 4; a++) {
+    for (int b = 0; b < 4; b++) {
+      const double w_ab = w[0][a] * w[1][b];
+      for (int c = 0; c < 4; c++) {
+        const Vector<3>& node = last_cell_nodes_[(a * 4 + b) * 4 + c];
+        const double w_abc = w_ab * w[2][c];
+        acc_ecef[0] += w_abc * node[0];
+        acc_ecef[1] += w_abc * node[1];
+        acc_ecef[2] += w_abc * node[2];
+      }
+    }
+  }
+  return acc_ecef;
+}
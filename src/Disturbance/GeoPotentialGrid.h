@@ -0,0 +1,111 @@
+/**
+ * @file GeoPotentialGrid.h
+ * @brief Lazily filled spherical grid cache of the geo-potential acceleration
+ */
+
+#ifndef __GEOPOTENTIAL_GRID_H__
+#define __GEOPOTENTIAL_GRID_H__
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "../Library/math/Vector.hpp"
+
+using libra::Vector;
+
+/**
+ * @class GeoPotentialGrid
+ * @brief Lazily filled spherical grid cache of the geo-potential acceleration
+ * @note The grid nodes are placed at constant steps of radius, latitude, and longitude in the ECEF frame.
+ *       The acceleration at a node is calculated only when the node is used for the first time, and the acceleration at
+ *       an arbitrary position is interpolated with the tricubic Lagrange interpolation of the surrounding 4x4x4 nodes.
+ *       When a grid cell is used for the first time, the interpolated value at the center of the cell is compared with
+ *       the directly calculated value. Cells whose error exceeds the tolerance always use the direct calculation.
+ *       The missing nodes of a new cell are calculated together with the batch calculation.
+ */
+class GeoPotentialGrid {
+ public:
+  /**
+   * @fn GeoPotentialGrid
+   * @brief Constructor
+   * @param [in] radius_step_m: Grid step of radius [m]
+   * @param [in] angle_step_rad: Grid step of latitude and longitude [rad]
+   * @param [in] tolerance_m_s2: Allowed interpolation error at the cell center [m/s2]
+   */
+  GeoPotentialGrid(const double radius_step_m, const double angle_step_rad, const double tolerance_m_s2);
+
+  /**
+   * @fn CalcAccelerationECEF
+   * @brief Calculate the acceleration in the ECEF frame with the grid interpolation
+   * @param [in] position_ecef: Position of the spacecraft in the ECEF fram [m]
+   * @param [in] calc_direct: Function to calculate the acceleration directly. It is used out of the grid and in the cells with large error.
+   * @param [in] calc_direct_batch: Function to calculate the accelerations at multiple positions directly. It is used to fill the grid nodes.
+   * @return Acceleration in the ECEF frame [m/s2]
+   */
+  Vector<3> CalcAccelerationECEF(const Vector<3>& position_ecef, const std::function<Vector<3>(const Vector<3>&)>& calc_direct,
+                                 const std::function<void(const std::vector<Vector<3>>&, std::vector<Vector<3>>&)>& calc_direct_batch);
+
+  // Getter
+  /**
+   * @fn GetNumNodes
+   * @brief Return number of the calculated grid nodes
+   */
+  inline size_t GetNumNodes() const { return nodes_.size(); }
+  /**
+   * @fn GetNumDirectCells
+   * @brief Return number of the cells which do not satisfy the tolerance and use the direct calculation
+   */
+  inline size_t GetNumDirectCells() const { return num_direct_cells_; }
+
+ private:
+  double radius_step_m_;   //!< Grid step of radius [m]
+  double lat_step_rad_;    //!< Grid step of latitude [rad]
+  double lon_step_rad_;    //!< Grid step of longitude [rad]
+  int num_lon_;            //!< Number of grid nodes in longitude direction
+  double tolerance_m_s2_;  //!< Allowed interpolation error at the cell center [m/s2]
+
+  std::unordered_map<uint64_t, Vector<3>> nodes_;  //!< Calculated grid nodes
+  std::unordered_map<uint64_t, bool> cells_;       //!< Checked grid cells (true: interpolation is available)
+  size_t num_direct_cells_ = 0;                    //!< Number of the cells which use the direct calculation
+
+  // Latest cell
+  uint64_t last_cell_key_ = 0;       //!< Key of the latest used cell
+  bool is_last_cell_set_ = false;    //!< Flag to show the latest cell is available
+  bool is_last_cell_valid_ = false;  //!< Flag to show the interpolation is available in the latest cell
+  Vector<3> last_cell_nodes_[64];    //!< Grid nodes surrounding the latest cell
+
+  // Workspace of the batch calculation
+  std::vector<uint64_t> missing_keys_;            //!< Keys of the grid nodes to be calculated
+  std::vector<Vector<3>> missing_positions_;      //!< Positions of the grid nodes to be calculated [m]
+  std::vector<Vector<3>> missing_accelerations_;  //!< Calculated accelerations at the grid nodes [m/s2]
+
+  /**
+   * @fn CalcKey
+   * @brief Calculate the key of a grid node or a grid cell
+   * @param [in] i_r: Index of radius
+   * @param [in] i_lat: Index of latitude
+   * @param [in] i_lon: Index of longitude
+   */
+  uint64_t CalcKey(const int i_r, const int i_lat, const int i_lon) const;
+  /**
+   * @fn SetCellNodes
+   * @brief Set the 4x4x4 grid nodes surrounding the cell to last_cell_nodes_. The nodes not calculated yet are calculated at once.
+   * @param [in] i_r: Index of radius of the cell
+   * @param [in] i_lat: Index of latitude of the cell
+   * @param [in] i_lon: Index of longitude of the cell
+   * @param [in] calc_direct_batch: Function to calculate the accelerations at multiple positions directly
+   */
+  void SetCellNodes(const int i_r, const int i_lat, const int i_lon,
+                    const std::function<void(const std::vector<Vector<3>>&, std::vector<Vector<3>>&)>& calc_direct_batch);
+  /**
+   * @fn Interpolate
+   * @brief Tricubic Lagrange interpolation in the latest cell
+   * @param [in] t_r: Normalized position in the cell in radius direction (0 <= t_r < 1)
+   * @param [in] t_lat: Normalized position in the cell in latitude direction (0 <= t_lat < 1)
+   * @param [in] t_lon: Normalized position in the cell in longitude direction (0 <= t_lon < 1)
+   */
+  Vector<3> Interpolate(const double t_r, const double t_lat, const double t_lon) const;
+};
+
+#endif  //__GEOPOTENTIAL_GRID_H__
@@ -0,0 +1,239 @@
+/**
+ * @file GeoPotentialRecursion.h
+ * @brief Recursion of the V and W functions and the acceleration terms shared by the kernels of GeoPotential
+ * @note The kernels differ only in the summation over the order m. The functions are forcibly inlined, so the kernels compiled for a
+ *       specific instruction set (e.g. GeoPotentialAvx2.cpp) also compile the recursion for the instruction set.
+ */
+
+#ifndef __GEOPOTENTIAL_RECURSION_H__
+#define __GEOPOTENTIAL_RECURSION_H__
+
+#include <Environment/Global/PhysicalConstants.hpp>
+#include <cmath>
+#include <utility>
+
+#include "../Library/math/Vector.hpp"
+#include "GeoPotentialCoefficients.h"
+
+#if defined(__GNUC__)
+#define GEOPOTENTIAL_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define GEOPOTENTIAL_INLINE __forceinline
+#else
+#define GEOPOTENTIAL_INLINE inline
+#endif
+
+namespace geopotential {
+
+/**
+ * @struct RecursionFactors
+ * @brief Factors of the positions used in the recursion of V and W
+ * @tparam kStride: Number of spacecraft calculated together
+ */
+template <int kStride>
+struct RecursionFactors {
+  double x_tmp[kStride];   //!< x * Re / r^2
+  double y_tmp[kStride];   //!< y * Re / r^2
+  double z_tmp[kStride];   //!< z * Re / r^2
+  double re_tmp[kStride];  //!< Re^2 / r^2
+  double re_r[kStride];    //!< Re / r, which is V of n = m = 0
+
+  /**
+   * @fn Set
+   * @brief Set the factors of a spacecraft
+   * @param [in] k: Index of the spacecraft
+   * @param [in] position_ecef: Position of the spacecraft in the ECEF frame [m]
+   */
+  GEOPOTENTIAL_INLINE void Set(const int k, const libra::Vector<3> &position_ecef) {
+    const double x = position_ecef[0], y = position_ecef[1], z = position_ecef[2];
+    const double r2 = x * x + y * y + z * z;
+    const double tmp = environment::earth_equatorial_radius_m / r2;
+    x_tmp[k] = x * tmp;
+    y_tmp[k] = y * tmp;
+    z_tmp[k] = z * tmp;
+    re_tmp[k] = environment::earth_equatorial_radius_m * tmp;
+    re_r[k] = environment::earth_equatorial_radius_m / sqrt(r2);
+  }
+};
+
+/**
+ * @struct VWRows
+ * @brief Last three rows (n-2, n-1, n) of the V and W functions
+ * @note The element (m, k) of a row is stored at m * kStride + k, where k is the index of the spacecraft.
+ *       V and W are calculated row by row (n = const), and the acceleration of degree n - 1 is summed as soon as the row n is available.
+ * @tparam kStride: Number of spacecraft calculated together
+ */
+template <int kStride>
+struct VWRows {
+  double *v_prev2;  //!< Row n - 2 of V
+  double *v_prev;   //!< Row n - 1 of V
+  double *v_curr;   //!< Row n of V
+  double *w_prev2;  //!< Row n - 2 of W
+  double *w_prev;   //!< Row n - 1 of W
+  double *w_curr;   //!< Row n of W
+
+  /**
+   * @fn VWRows
+   * @brief Constructor. The row n = 0 is set as the previous row.
+   * @param [in] v: Workspace of V with 3 * (degree + 2) * kStride elements
+   * @param [in] w: Workspace of W with 3 * (degree + 2) * kStride elements
+   * @param [in] degree: Maximum degree of the acceleration
+   * @param [in] factors: Factors of the positions
+   */
+  GEOPOTENTIAL_INLINE VWRows(double *v, double *w, const int degree, const RecursionFactors<kStride> &factors) {
+    const int row_size = (degree + 2) * kStride;
+    v_prev2 = v;
+    v_prev = v + row_size;
+    v_curr = v + 2 * row_size;
+    w_prev2 = w;
+    w_prev = w + row_size;
+    w_curr = w + 2 * row_size;
+    // n=m=0
+    for (int k = 0; k < kStride; k++) {
+      v_prev[k] = factors.re_r[k];
+      w_prev[k] = 0.0;
+    }
+  }
+
+  /**
+   * @fn Calc
+   * @brief Calculate the row n from the rows n - 1 and n - 2
+   * @param [in] coefficients: Coefficient tables
+   * @param [in] n: Degree of the row
+   * @param [in] factors: Factors of the positions
+   */
+  GEOPOTENTIAL_INLINE void Calc(const GeoPotentialCoefficients &coefficients, const int n, const RecursionFactors<kStride> &factors) {
+    const double *c1 = coefficients.GetVWnmCoeff1(n);
+    const double *c2 = coefficients.GetVWnmCoeff2(n);
+    // V and W are calculated in separate loops, which the compiler vectorizes with a few alias checks
+    CalcOrders(n, c1, c2, factors, v_prev, v_prev2, v_curr);
+    CalcOrders(n, c1, c2, factors, w_prev, w_prev2, w_curr);
+    const double c_nn = coefficients.GetVWnnCoeff(n);
+    for (int k = 0; k < kStride; k++) {
+      // m = n - 1
+      const int i = (n - 1) * kStride + k;
+      v_curr[i] = c1[n - 1] * factors.z_tmp[k] * v_prev[i];
+      w_curr[i] = c1[n - 1] * factors.z_tmp[k] * w_prev[i];
+      // m = n
+      v_curr[i + kStride] = c_nn * (factors.x_tmp[k] * v_prev[i] - factors.y_tmp[k] * w_prev[i]);
+      w_curr[i + kStride] = c_nn * (factors.x_tmp[k] * w_prev[i] + factors.y_tmp[k] * v_prev[i]);
+    }
+  }
+
+  /**
+   * @fn CalcOrders
+   * @brief Calculate the orders m = 0 to n - 2 of the row n of V or W
+   * @param [in] n: Degree of the row
+   * @param [in] c1: Coefficients multiplied to the row n - 1
+   * @param [in] c2: Coefficients multiplied to the row n - 2
+   * @param [in] factors: Factors of the positions
+   * @param [in] prev: Row n - 1
+   * @param [in] prev2: Row n - 2
+   * @param [out] curr: Row n
+   */
+  static GEOPOTENTIAL_INLINE void CalcOrders(const int n, const double *c1, const double *c2, const RecursionFactors<kStride> &factors,
+                                             const double *prev, const double *prev2, double *curr) {
+    // Local copies, which the compiler knows are not overwritten by the stores to the row
+    double z_tmp[kStride], re_tmp[kStride];
+    for (int k = 0; k < kStride; k++) {
+      z_tmp[k] = factors.z_tmp[k];
+      re_tmp[k] = factors.re_tmp[k];
+    }
+    for (int m = 0; m <= n - 2; m++) {
+      for (int k = 0; k < kStride; k++) {
+        const int i = m * kStride + k;
+        curr[i] = c1[m] * z_tmp[k] * prev[i] - c2[m] * re_tmp[k] * prev2[i];
+      }
+    }
+  }
+
+  /**
+   * @fn Next
+   * @brief Move to the next row
+   */
+  GEOPOTENTIAL_INLINE void Next() {
+    std::swap(v_prev2, v_prev);
+    std::swap(v_prev, v_curr);
+    std::swap(w_prev2, w_prev);
+    std::swap(w_prev, w_curr);
+  }
+};
+
+/**
+ * @struct DegreeCoefficients
+ * @brief Coefficients of a degree used in the summation over the order m
+ */
+struct DegreeCoefficients {
+  const double *c;    //!< Normalized C coefficients
+  const double *s;    //!< Normalized S coefficients
+  const double *xy1;  //!< Factors of the x and y accelerations from the order m + 1
+  const double *xy2;  //!< Factors of the x and y accelerations from the order m - 1
+  const double *nz;   //!< Factors of the z acceleration
+
+  /**
+   * @fn DegreeCoefficients
+   * @brief Constructor
+   * @param [in] coefficients: Coefficient tables
+   * @param [in] deg: Degree
+   */
+  GEOPOTENTIAL_INLINE DegreeCoefficients(const GeoPotentialCoefficients &coefficients, const int deg)
+      : c(coefficients.GetC(deg)),
+        s(coefficients.GetS(deg)),
+        xy1(coefficients.GetAccXY1(deg)),
+        xy2(coefficients.GetAccXY2(deg)),
+        nz(coefficients.GetAccZ(deg)) {}
+};
+
+/**
+ * @fn AddZeroOrderTerm
+ * @brief Add the acceleration term of the order m = 0
+ * @param [in] d: Coefficients of the degree
+ * @param [in] v: Head of the row of V of the spacecraft
+ * @param [in] w: Head of the row of W of the spacecraft
+ * @param [in/out] acc_x, acc_y, acc_z: Accumulators of the acceleration
+ * @tparam kStride: Number of spacecraft interleaved in the rows
+ */
+template <int kStride>
+GEOPOTENTIAL_INLINE void AddZeroOrderTerm(const DegreeCoefficients &d, const double *v, const double *w, double &acc_x, double &acc_y,
+                                          double &acc_z) {
+  acc_x += -d.c[0] * v[kStride] * d.xy1[0];
+  acc_y += -d.c[0] * w[kStride] * d.xy1[0];
+  acc_z += (-d.c[0] * v[0] - d.s[0] * w[0]) * d.nz[0];
+}
+
+/**
+ * @fn AddOrderTerm
+ * @brief Add the acceleration term of the order m (>= 1)
+ * @param [in] d: Coefficients of the degree
+ * @param [in] m: Order
+ * @param [in] v: Head of the row of V of the spacecraft
+ * @param [in] w: Head of the row of W of the spacecraft
+ * @param [in/out] acc_x, acc_y, acc_z: Accumulators of the acceleration
+ * @tparam kStride: Number of spacecraft interleaved in the rows
+ */
+template <int kStride>
+GEOPOTENTIAL_INLINE void AddOrderTerm(const DegreeCoefficients &d, const int m, const double *v, const double *w, double &acc_x, double &acc_y,
+                                      double &acc_z) {
+  const double vp = v[(m + 1) * kStride], v0 = v[m * kStride], vm = v[(m - 1) * kStride];
+  const double wp = w[(m + 1) * kStride], w0 = w[m * kStride], wm = w[(m - 1) * kStride];
+  acc_x += d.xy1[m] * (-d.c[m] * vp - d.s[m] * wp) + d.xy2[m] * (d.c[m] * vm + d.s[m] * wm);
+  acc_y += d.xy1[m] * (-d.c[m] * wp + d.s[m] * vp) + d.xy2[m] * (-d.c[m] * wm + d.s[m] * vm);
+  acc_z += (-d.c[m] * v0 - d.s[m] * w0) * d.nz[m];
+}
+
+/**
+ * @fn ScaleAcceleration
+ * @brief Return the acceleration from the sums of the terms [m/s2]
+ */
+GEOPOTENTIAL_INLINE libra::Vector<3> ScaleAcceleration(const double acc_x, const double acc_y, const double acc_z) {
+  const double coeff = environment::earth_gravitational_constant_m3_s2 / (environment::earth_equatorial_radius_m * environment::earth_equatorial_radius_m);
+  libra::Vector<3> acc_ecef;
+  acc_ecef[0] = acc_x * coeff;
+  acc_ecef[1] = acc_y * coeff;
+  acc_ecef[2] = acc_z * coeff;
+  return acc_ecef;
+}
+
+}  // namespace geopotential
+
+#endif  //__GEOPOTENTIAL_RECURSION_H__
@@ -32,18 +32,10 @@ Vector<3> GravityGradient::CalcTorque(const Vector<3> r_b_m, const Matrix<3, 3>
   return torque_b_;
 }
 
-string GravityGradient::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector("ggtorque", "b", "Nm", 3);
-
-  return str_tmp;
+void GravityGradient::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("ggtorque", "b", "Nm", 3);
 }
 
-string GravityGradient::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector(torque_b_);
-
-  return str_tmp;
+void GravityGradient::LogValues(LogSink& sink) const {
+  sink.Add(torque_b_);
 }
@@ -6,6 +6,8 @@
 #include "InitDisturbance.hpp"
 
 #include <Interface/InitInput/IniAccess.h>
+#include <Library/math/Constant.hpp>
+#include <iostream>
 
 #define CALC_LABEL "calculation"
 #define LOG_LABEL "logging"
@@ -83,6 +85,25 @@ GeoPotential InitGeoPotential(std::string ini_path) {
   int degree = conf.ReadInt(section, "degree");
   std::string file_path = conf.ReadString(section, "file_path");
   GeoPotential geop(degree, file_path);
+  std::string method = conf.ReadString(section, "method");
+  if (method == "GRID") {
+    double grid_radius_step_m = conf.ReadDouble(section, "grid_radius_step_m");
+    double grid_angle_step_rad = conf.ReadDouble(section, "grid_angle_step_deg") * libra::deg_to_rad;
+    double grid_tolerance_m_s2 = conf.ReadDouble(section, "grid_tolerance_m_s2");
+    geop.SetGridMethod(grid_radius_step_m, grid_angle_step_rad, grid_tolerance_m_s2);
+  } else if (method != "DIRECT" && method != "") {
+    std::cerr << "Warning: GeoPotential method: " << method << " is not defined. DIRECT is used." << std::endl;
+  }
+  std::string kernel = conf.ReadString(section, "kernel");
+  if (kernel == "SCALAR") {
+    geop.SetKernel(GeoPotentialKernel::Scalar);
+  } else if (kernel == "PORTABLE") {
+    geop.SetKernel(GeoPotentialKernel::Portable);
+  } else if (kernel == "AVX2") {
+    geop.SetKernel(GeoPotentialKernel::Avx2);
+  } else if (kernel != "AUTO" && kernel != "") {
+    std::cerr << "Warning: GeoPotential kernel: " << kernel << " is not defined. AUTO is used." << std::endl;
+  }
   geop.IsCalcEnabled = conf.ReadEnable(section, CALC_LABEL);
   geop.IsLogEnabled = conf.ReadEnable(section, LOG_LABEL);
 
@@ -16,7 +16,12 @@ using libra::NormalRand;
 using namespace std;
 
 MagDisturbance::MagDisturbance(const Vector<3>& rmm_const_b, const double rmm_rwdev, const double rmm_rwlimit, const double rmm_wnvar)
-    : rmm_const_b_(rmm_const_b), rmm_rwdev_(rmm_rwdev), rmm_rwlimit_(rmm_rwlimit), rmm_wnvar_(rmm_wnvar) {
+    : rmm_const_b_(rmm_const_b),
+      rmm_rwdev_(rmm_rwdev),
+      rmm_rwlimit_(rmm_rwlimit),
+      rmm_wnvar_(rmm_wnvar),
+      rmm_random_walk_(0.1, Vector<3>(rmm_rwdev), Vector<3>(rmm_rwlimit)),
+      rmm_white_noise_(0.0, rmm_wnvar, g_rand.MakeSeed()) {
   for (int i = 0; i < 3; ++i) {
     torque_b_[i] = 0;
   }
@@ -37,16 +42,11 @@ void MagDisturbance::Update(const LocalEnvironment& local_env, const Dynamics& d
 }
 
 void MagDisturbance::CalcRMM() {
-  static Vector<3> stddev(rmm_rwdev_);
-  static Vector<3> limit(rmm_rwlimit_);
-  static RandomWalk<3> rw(0.1, stddev, limit);
-  static NormalRand nr(0.0, rmm_wnvar_, g_rand.MakeSeed());
-
   rmm_b_ = rmm_const_b_;
   for (int i = 0; i < 3; ++i) {
-    rmm_b_[i] += rw[i] + nr;
+    rmm_b_[i] += rmm_random_walk_[i] + rmm_white_noise_;
   }
-  ++rw;  // Update random walk
+  ++rmm_random_walk_;  // Update random walk
 }
 
 void MagDisturbance::PrintTorque() {
@@ -54,20 +54,12 @@ void MagDisturbance::PrintTorque() {
   cout << endl;
 }
 
-string MagDisturbance::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector("rmm", "b", "Am^2", 3);
-  str_tmp += WriteVector("mag_dist_torque", "b", "Nm", 3);
-
-  return str_tmp;
+void MagDisturbance::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("rmm", "b", "Am^2", 3);
+  schema.AddVector("mag_dist_torque", "b", "Nm", 3);
 }
 
-string MagDisturbance::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector(rmm_b_);
-  str_tmp += WriteVector(torque_b_);
-
-  return str_tmp;
+void MagDisturbance::LogValues(LogSink& sink) const {
+  sink.Add(rmm_b_);
+  sink.Add(torque_b_);
 }
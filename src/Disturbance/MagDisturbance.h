@@ -8,6 +8,8 @@
 
 #include <string>
 
+#include "../Library/math/NormalRand.hpp"
+#include "../Library/math/RandomWalk.hpp"
 #include "../Library/math/Vector.hpp"
 using libra::Vector;
 
@@ -27,6 +29,9 @@ class MagDisturbance : public SimpleDisturbance {
   double rmm_rwlimit_;     //!< Limit of random walk component of the RMM [Am2]
   double rmm_wnvar_;       //!< Standard deviation of white noise of the RMM [Am2]
 
+  RandomWalk<3> rmm_random_walk_;     //!< Random walk component of the RMM
+  libra::NormalRand rmm_white_noise_;  //!< White noise component of the RMM
+
  public:
   /**
    * @fn MagDisturbance
@@ -58,15 +63,15 @@ class MagDisturbance : public SimpleDisturbance {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 };
 
 #endif  //__MagDisturbance_H__
@@ -31,20 +31,12 @@ void SolarRadiation::CalcCoef(Vector<3>& input_b, double item) {
   }
 }
 
-std::string SolarRadiation::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("srp_torque", "b", "Nm", 3);
-  str_tmp += WriteVector("srp_force", "b", "N", 3);
-
-  return str_tmp;
+void SolarRadiation::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("srp_torque", "b", "Nm", 3);
+  schema.AddVector("srp_force", "b", "N", 3);
 }
 
-std::string SolarRadiation::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(torque_b_);
-  str_tmp += WriteVector(force_b_);
-
-  return str_tmp;
+void SolarRadiation::LogValues(LogSink& sink) const {
+  sink.Add(torque_b_);
+  sink.Add(force_b_);
 }
@@ -0,0 +1,80 @@
+/**
+ * @file TestGeoPotential.cpp
+ * @brief Test codes for GeoPotential class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "GeoPotential.h"
+
+namespace {
+const int kDegree = 360;
+// Relative tolerance of the kernels to the scalar reference.
+// The kernels only reorder the summation and use FMA, so they agree to a small multiple of the machine epsilon of the sum.
+const double kRelativeTolerance = 1e-12;
+
+/**
+ * @fn WriteCoefficientFile
+ * @brief Write a synthetic coefficient file in the EGM96 format. The magnitudes follow the Kaula rule (1e-5 / n^2).
+ */
+std::string WriteCoefficientFile() {
+  const std::string file_path = "TestGeoPotential_coefficients.txt";
+  std::remove((file_path + ".bin").c_str());
+  std::ofstream file(file_path);
+  file.precision(17);
+  for (int n = 2; n <= kDegree; n++) {
+    for (int m = 0; m <= n; m++) {
+      const double kaula = 1e-5 / (n * n);
+      const double c = (n == 2 && m == 0) ? -4.841653717360e-04 : kaula * sin(1.3 * n + 0.7 * m);
+      const double s = (m == 0) ? 0.0 : kaula * cos(0.9 * n - 1.1 * m);
+      file << n << " " << m << " " << c << " " << s << " 0 0\n";
+    }
+  }
+  return file_path;
+}
+
+/**
+ * @fn ExpectKernelAgreesWithScalar
+ * @brief Compare the acceleration of the kernel with the scalar reference at positions over the sphere and some altitudes
+ */
+void ExpectKernelAgreesWithScalar(const GeoPotentialKernel kernel) {
+  static const std::string file_path = WriteCoefficientFile();
+  GeoPotential reference(kDegree, file_path);
+  reference.SetKernel(GeoPotentialKernel::Scalar);
+  GeoPotential target(kDegree, file_path);
+  target.SetKernel(kernel);
+  ASSERT_EQ(kernel, target.GetKernel());
+
+  const double radii_m[] = {6378137.0 + 400e3, 6378137.0 + 2000e3, 42164e3};
+  for (const double radius_m : radii_m) {
+    for (int i = 0; i < 16; i++) {
+      const double lat = -1.5 + 3.0 * i / 15.0;
+      const double lon = 0.4 * i - 3.0;
+      libra::Vector<3> position_ecef;
+      position_ecef[0] = radius_m * cos(lat) * cos(lon);
+      position_ecef[1] = radius_m * cos(lat) * sin(lon);
+      position_ecef[2] = radius_m * sin(lat);
+
+      reference.CalcAccelerationECEF(position_ecef);
+      target.CalcAccelerationECEF(position_ecef);
+      const libra::Vector<3> expected = reference.GetAccelerationECEF();
+      const libra::Vector<3> actual = target.GetAccelerationECEF();
+      const double scale = norm(expected);
+      for (int axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(expected[axis], actual[axis], kRelativeTolerance * scale);
+      }
+    }
+  }
+}
+}  // namespace
+
+TEST(GeoPotential, PortableKernelAgreesWithScalar) { ExpectKernelAgreesWithScalar(GeoPotentialKernel::Portable); }
+
+TEST(GeoPotential, Avx2KernelAgreesWithScalar) {
+  if (!GeoPotential::IsKernelSupported(GeoPotentialKernel::Avx2)) GTEST_SKIP() << "AVX2 is not supported";
+  ExpectKernelAgreesWithScalar(GeoPotentialKernel::Avx2);
+}
@@ -38,16 +38,10 @@ libra::Vector<3> ThirdBodyGravity::CalcAcceleration(libra::Vector<3> s, libra::V
   return acc;
 }
 
-std::string ThirdBodyGravity::GetLogHeader() const {
-  std::string str_tmp = "";
-  str_tmp += WriteVector("acc_thirdbody", "i", "m/s2", 3);
-
-  return str_tmp;
+void ThirdBodyGravity::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("acc_thirdbody", "i", "m/s2", 3);
 }
 
-std::string ThirdBodyGravity::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteVector(acceleration_i_);
-
-  return str_tmp;
+void ThirdBodyGravity::LogValues(LogSink& sink) const {
+  sink.Add(acceleration_i_);
 }
@@ -38,15 +38,15 @@ class ThirdBodyGravity : public AccelerationDisturbance {
  private:
   // Override classes for ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override function of GetLogHeader
+   * @fn GetLogSchema
+   * @brief Override function of GetLogSchema
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override function of GetLogValue
+   * @fn LogValues
+   * @brief Override function of LogValues
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
   /**
    * @fn CalcAcceleration
@@ -18,28 +18,20 @@ Attitude::Attitude(const std::string& sim_object_name) : SimulationObject(sim_ob
   k_sc_J_ = 0.0;
 }
 
-std::string Attitude::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("omega_true", "b", "rad/s", 3);
-  str_tmp += WriteVector("quaternion_true", "i2b", "-", 4);
-  str_tmp += WriteVector("torque_true", "b", "Nm", 3);
-  str_tmp += WriteScalar("h_total", "Nms");
-  str_tmp += WriteScalar("k_sc", "J");
-
-  return str_tmp;
+void Attitude::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("omega_true", "b", "rad/s", 3);
+  schema.AddVector("quaternion_true", "i2b", "-", 4);
+  schema.AddVector("torque_true", "b", "Nm", 3);
+  schema.AddScalar("h_total", "Nms");
+  schema.AddScalar("k_sc", "J");
 }
 
-std::string Attitude::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(omega_b_rad_s_);
-  str_tmp += WriteQuaternion(quaternion_i2b_);
-  str_tmp += WriteVector(torque_b_Nm_);
-  str_tmp += WriteScalar(h_total_Nms_);
-  str_tmp += WriteScalar(k_sc_J_);
-
-  return str_tmp;
+void Attitude::LogValues(LogSink& sink) const {
+  sink.Add(omega_b_rad_s_);
+  sink.Add(quaternion_i2b_);
+  sink.Add(torque_b_Nm_);
+  sink.Add(h_total_Nms_);
+  sink.Add(k_sc_J_);
 }
 
 void Attitude::SetParameters(const MCSimExecutor& mc_sim) { GetInitParameterQuaternion(mc_sim, "Q_i2b", quaternion_i2b_); }
@@ -23,6 +23,7 @@ Dynamics::~Dynamics() {
 void Dynamics::Initialize(SimulationConfig* sim_config, const SimTime* sim_time, const LocalCelestialInformation* local_celes_info, const int sat_id,
                           Structure* structure, RelativeInformation* rel_info) {
   mass_ = structure->GetKinematicsParams().GetMass();
+  sun_id_ = local_celes_info->GetGlobalInfo().CalcBodyIdFromName("SUN");
 
   // Initialize
   orbit_ = InitOrbit(&(local_celes_info->GetGlobalInfo()), sim_config->sat_file_[sat_id], sim_time->GetOrbitRKStepSec(), sim_time->GetCurrentJd(),
@@ -49,11 +50,7 @@ void Dynamics::Update(const SimTime* sim_time, const LocalCelestialInformation*
 
   // Thermal
   if (sim_time->GetThermalPropagateFlag()) {
-    std::string sun_str = "SUN";
-    char* c_sun = new char[sun_str.size() + 1];
-    std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
-    temperature_->Propagate(local_celes_info->GetPosFromSC_b(c_sun), sim_time->GetElapsedSec());
-    delete[] c_sun;
+    temperature_->Propagate(local_celes_info->GetPosFromSC_b(sun_id_), sim_time->GetElapsedSec());
   }
 }
 
@@ -64,8 +61,9 @@ void Dynamics::ClearForceTorque(void) {
 }
 
 void Dynamics::LogSetup(Logger& logger) {
-  logger.AddLoggable(attitude_);
-  logger.AddLoggable(orbit_);
+  logger.AddLoggable(attitude_, "attitude");
+  logger.AddLoggable(orbit_, "orbit");
+  logger.AddLoggable(temperature_, "thermal");
 }
 
 void Dynamics::AddTorque_b(Vector<3> torque_b) { attitude_->AddTorque_b(torque_b); }
@@ -137,6 +137,7 @@ class Dynamics {
   Attitude* attitude_;        //!< Attitude dynamics
   Orbit* orbit_;              //!< Orbit dynamics
   Temperature* temperature_;  //!< Thermal dynamics
+  int sun_id_;                //!< ID of the sun in the CelestialInformation list
 };
 
 #endif  //__dynamics_H__
@@ -23,32 +23,24 @@ void KeplerOrbitPropagation::Propagate(double endtime, double current_jd) {
   UpdateState(current_jd);
 }
 
-std::string KeplerOrbitPropagation::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("sat_position", "i", "m", 3);
-  str_tmp += WriteVector("sat_velocity", "i", "m/s", 3);
-  str_tmp += WriteVector("sat_velocity", "b", "m/s", 3);
-  str_tmp += WriteVector("sat_acc_i", "i", "m/s^2", 3);
-  str_tmp += WriteScalar("lat", "rad");
-  str_tmp += WriteScalar("lon", "rad");
-  str_tmp += WriteScalar("alt", "m");
-
-  return str_tmp;
+void KeplerOrbitPropagation::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("sat_position", "i", "m", 3, 16);
+  schema.AddVector("sat_velocity", "i", "m/s", 3, 10);
+  schema.AddVector("sat_velocity", "b", "m/s", 3, 10);
+  schema.AddVector("sat_acc_i", "i", "m/s^2", 3, 10);
+  schema.AddScalar("lat", "rad");
+  schema.AddScalar("lon", "rad");
+  schema.AddScalar("alt", "m");
 }
 
-std::string KeplerOrbitPropagation::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(sat_position_i_, 16);
-  str_tmp += WriteVector(sat_velocity_i_, 10);
-  str_tmp += WriteVector(sat_velocity_b_, 10);
-  str_tmp += WriteVector(acc_i_, 10);
-  str_tmp += WriteScalar(sat_position_geo_.GetLat_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetLon_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetAlt_m());
-
-  return str_tmp;
+void KeplerOrbitPropagation::LogValues(LogSink& sink) const {
+  sink.Add(sat_position_i_);
+  sink.Add(sat_velocity_i_);
+  sink.Add(sat_velocity_b_);
+  sink.Add(acc_i_);
+  sink.Add(sat_position_geo_.GetLat_rad());
+  sink.Add(sat_position_geo_.GetLon_rad());
+  sink.Add(sat_position_geo_.GetAlt_m());
 }
 
 // Private Function
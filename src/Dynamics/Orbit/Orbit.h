@@ -168,15 +168,15 @@ class Orbit : public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const = 0;
+  virtual void GetLogSchema(LogSchema& schema) const = 0;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const = 0;
+  virtual void LogValues(LogSink& sink) const = 0;
 
  protected:
   const CelestialInformation* celes_info_;  //!< Celestial information
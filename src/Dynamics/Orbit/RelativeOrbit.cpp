@@ -151,34 +151,26 @@ void RelativeOrbit::RHS(double t, const Vector<6>& state, Vector<6>& rhs)  // on
   (void)t;
 }
 
-std::string RelativeOrbit::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("sat_position", "i", "m", 3);
-  str_tmp += WriteVector("sat_velocity", "i", "m/s", 3);
-  str_tmp += WriteVector("sat_velocity", "b", "m/s", 3);
-  str_tmp += WriteVector("sat_position_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3);
-  str_tmp += WriteVector("sat_velocity_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3);
-  str_tmp += WriteVector("sat_acc_i", "i", "m/s^2", 3);
-  str_tmp += WriteScalar("lat", "rad");
-  str_tmp += WriteScalar("lon", "rad");
-  str_tmp += WriteScalar("alt", "m");
-
-  return str_tmp;
+void RelativeOrbit::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("sat_position", "i", "m", 3, 16);
+  schema.AddVector("sat_velocity", "i", "m/s", 3, 10);
+  schema.AddVector("sat_velocity", "b", "m/s", 3, 10);
+  schema.AddVector("sat_position_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3, 10);
+  schema.AddVector("sat_velocity_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3, 10);
+  schema.AddVector("sat_acc_i", "i", "m/s^2", 3, 10);
+  schema.AddScalar("lat", "rad");
+  schema.AddScalar("lon", "rad");
+  schema.AddScalar("alt", "m");
 }
 
-std::string RelativeOrbit::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(sat_position_i_, 16);
-  str_tmp += WriteVector(sat_velocity_i_, 10);
-  str_tmp += WriteVector(sat_velocity_b_, 10);
-  str_tmp += WriteVector(relative_position_lvlh_, 10);
-  str_tmp += WriteVector(relative_velocity_lvlh_, 10);
-  str_tmp += WriteVector(acc_i_, 10);
-  str_tmp += WriteScalar(sat_position_geo_.GetLat_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetLon_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetAlt_m());
-
-  return str_tmp;
+void RelativeOrbit::LogValues(LogSink& sink) const {
+  sink.Add(sat_position_i_);
+  sink.Add(sat_velocity_i_);
+  sink.Add(sat_velocity_b_);
+  sink.Add(relative_position_lvlh_);
+  sink.Add(relative_velocity_lvlh_);
+  sink.Add(acc_i_);
+  sink.Add(sat_position_geo_.GetLat_rad());
+  sink.Add(sat_position_geo_.GetLon_rad());
+  sink.Add(sat_position_geo_.GetAlt_m());
 }
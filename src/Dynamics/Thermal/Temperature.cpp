@@ -129,30 +129,17 @@ void Temperature::AddHeaterPower(vector<double> heater_power) {
 
 vector<Node> Temperature::GetVnodes() const { return vnodes_; }
 
-string Temperature::GetLogHeader() const {
-  string str_tmp = "";
+void Temperature::GetLogSchema(LogSchema& schema) const {
   for (int i = 0; i < node_num_; i++) {
     string str_node = "temp_" + to_string(vnodes_[i].GetNodeId()) + " (" + vnodes_[i].GetNodeLabel() + ")";
-    str_tmp += WriteScalar(str_node, "deg");
-  }
-  /*
-  下記のコードのようにiteratorでアクセスすると,
-  インスタンス化されていないメンバ関数のアドレスを取っていることになり
-  うまくいかない
-  for (auto itr = vnodes_.cbegin() + 1; itr != vnodes_.cend(); ++itr) {
-          string str_node = "temp_" + to_string((*itr->GetNodeId)()) + " (" +
-  to_string((*itr->GetNodeLabel)()) + ")"; str_tmp += WriteScalar(str_node,
-  "[deg]");
-  }*/
-  return str_tmp;
+    schema.AddScalar(str_node, "deg");
+  }
 }
 
-string Temperature::GetLogValue() const {
-  string str_tmp = "";
+void Temperature::LogValues(LogSink& sink) const {
   for (int i = 0; i < node_num_; i++) {
-    str_tmp += WriteScalar(vnodes_[i].GetTemperature_deg());
+    sink.Add(vnodes_[i].GetTemperature_deg());
   }
-  return str_tmp;
 }
 
 void Temperature::PrintParams(void) {
@@ -34,8 +34,8 @@ class Temperature : public ILoggable {
                  const double endtime);  //太陽入熱量計算のため, 太陽方向の情報を入手
   std::vector<Node> GetVnodes() const;
   void AddHeaterPower(std::vector<double> heater_power);
-  std::string GetLogHeader() const;
-  std::string GetLogValue() const;
+  void GetLogSchema(LogSchema& schema) const;
+  void LogValues(LogSink& sink) const;
   void PrintParams(void);  //デバッグ出力
 };
 #endif  //__temperature_H__
@@ -0,0 +1,85 @@
+/**
+ * @file AtmosphereDensityGrid.cpp
+ * @brief Lazily filled grid cache of the NRLMSISE00 atmospheric density
+ */
+
+#include "AtmosphereDensityGrid.h"
+
+#include <Library/math/Constant.hpp>
+#include <Library/nrlmsise00/Wrapper_nrlmsise00.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+AtmosphereDensityGrid::AtmosphereDensityGrid(const double update_period_s, const double min_altitude_m, const double max_altitude_m,
+                                             const double altitude_step_m, const double latitude_step_rad, const double local_time_step_hour)
+    : update_period_year_(update_period_s / (365.25 * 86400.0)), min_altitude_m_(min_altitude_m), altitude_step_m_(altitude_step_m) {
+  // Steps are adjusted to divide the ranges
+  num_altitude_ = max((int)ceil((max_altitude_m - min_altitude_m) / altitude_step_m - 1e-9), 1) + 1;
+  max_altitude_m_ = min_altitude_m_ + (num_altitude_ - 1) * altitude_step_m_;
+  num_latitude_ = max((int)ceil(180.0 / (latitude_step_rad * libra::rad_to_deg) - 1e-9), 1) + 1;
+  latitude_step_deg_ = 180.0 / (num_latitude_ - 1);
+  num_local_time_ = max((int)ceil(24.0 / local_time_step_hour - 1e-9), 1);
+  local_time_step_hour_ = 24.0 / num_local_time_;
+
+  const size_t num_nodes = (size_t)num_altitude_ * num_latitude_ * num_local_time_;
+  log_density_.assign(num_nodes, 0.0);
+  node_generation_.assign(num_nodes, 0);
+}
+
+double AtmosphereDensityGrid::CalcAirDensity(const double decyear, const double latrad, const double lonrad, const double alt,
+                                             const function<double(double, double, double, double)>& calc_direct) {
+  if (alt < min_altitude_m_ || alt >= max_altitude_m_) return calc_direct(decyear, latrad, lonrad, alt);
+
+  if (!is_epoch_set_ || fabs(decyear - epoch_decyear_) >= update_period_year_) {
+    is_epoch_set_ = true;
+    epoch_decyear_ = decyear;
+    epoch_ut_hour_ = CalcNRLMSISE00UtSec(decyear) / 3600.0;
+    generation_++;
+  }
+
+  // Local solar time is defined in the same way as the NRLMSISE00 model
+  double local_time_hour = fmod(CalcNRLMSISE00UtSec(decyear) / 3600.0 + lonrad * libra::rad_to_deg / 15.0, 24.0);
+  if (local_time_hour < 0.0) local_time_hour += 24.0;
+
+  const double f_alt = (alt - min_altitude_m_) / altitude_step_m_;
+  const double f_lat = (latrad * libra::rad_to_deg + 90.0) / latitude_step_deg_;
+  const double f_lst = local_time_hour / local_time_step_hour_;
+  const int i_alt = min((int)f_alt, num_altitude_ - 2);
+  const int i_lat = min(max((int)floor(f_lat), 0), num_latitude_ - 2);
+  const int i_lst = min((int)f_lst, num_local_time_ - 1);
+  const int i_lst_next = (i_lst + 1) % num_local_time_;
+  const double t_alt = f_alt - i_alt;
+  const double t_lat = min(max(f_lat - i_lat, 0.0), 1.0);
+  const double t_lst = f_lst - i_lst;
+
+  double log_density = 0.0;
+  for (int a = 0; a < 2; a++) {
+    const double w_a = a ? t_alt : 1.0 - t_alt;
+    for (int b = 0; b < 2; b++) {
+      const double w_ab = w_a * (b ? t_lat : 1.0 - t_lat);
+      log_density += w_ab * (1.0 - t_lst) * GetNode(i_alt + a, i_lat + b, i_lst, calc_direct);
+      log_density += w_ab * t_lst * GetNode(i_alt + a, i_lat + b, i_lst_next, calc_direct);
+    }
+  }
+
+  // Nodes without positive density cannot be interpolated in the logarithmic scale
+  if (std::isnan(log_density)) return calc_direct(decyear, latrad, lonrad, alt);
+  return exp(log_density);
+}
+
+double AtmosphereDensityGrid::GetNode(const int i_alt, const int i_lat, const int i_lst,
+                                      const function<double(double, double, double, double)>& calc_direct) {
+  const size_t index = ((size_t)i_alt * num_latitude_ + i_lat) * num_local_time_ + i_lst;
+  if (node_generation_[index] == generation_) return log_density_[index];
+
+  const double alt = min_altitude_m_ + i_alt * altitude_step_m_;
+  const double latrad = (-90.0 + i_lat * latitude_step_deg_) * libra::deg_to_rad;
+  const double lonrad = (i_lst * local_time_step_hour_ - epoch_ut_hour_) * 15.0 * libra::deg_to_rad;
+  const double density = calc_direct(epoch_decyear_, latrad, lonrad, alt);
+  log_density_[index] = density > 0.0 ? log(density) : NAN;
+  node_generation_[index] = generation_;
+  num_calculated_nodes_++;
+  return log_density_[index];
+}
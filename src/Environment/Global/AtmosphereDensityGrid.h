@@ -0,0 +1,88 @@
+/**
+ * @file AtmosphereDensityGrid.h
+ * @brief Lazily filled grid cache of the NRLMSISE00 atmospheric density
+ */
+
+#ifndef __ATMOSPHERE_DENSITY_GRID_H__
+#define __ATMOSPHERE_DENSITY_GRID_H__
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @class AtmosphereDensityGrid
+ * @brief Lazily filled grid cache of the NRLMSISE00 atmospheric density
+ * @note The grid nodes are placed at constant steps of altitude, geodetic latitude, and local solar time, which are the dominant
+ *       dependencies of the density. The density at a node is calculated at the grid epoch only when the node is used for the first time,
+ *       and the density at an arbitrary position is interpolated with the trilinear interpolation of the logarithmic density.
+ *       All nodes are discarded and the epoch is moved to the current time when the update period has passed since the epoch.
+ *       Positions out of the altitude range use the direct calculation.
+ */
+class AtmosphereDensityGrid {
+ public:
+  /**
+   * @fn AtmosphereDensityGrid
+   * @brief Constructor
+   * @param [in] update_period_s: Period to discard the grid nodes [s]
+   * @param [in] min_altitude_m: Minimum altitude of the grid [m]
+   * @param [in] max_altitude_m: Maximum altitude of the grid [m]
+   * @param [in] altitude_step_m: Grid step of altitude [m]
+   * @param [in] latitude_step_rad: Grid step of latitude [rad]
+   * @param [in] local_time_step_hour: Grid step of local solar time [hour]
+   */
+  AtmosphereDensityGrid(const double update_period_s, const double min_altitude_m, const double max_altitude_m, const double altitude_step_m,
+                        const double latitude_step_rad, const double local_time_step_hour);
+
+  /**
+   * @fn CalcAirDensity
+   * @brief Calculate atmospheric density with the grid interpolation
+   * @param [in] decyear: Decimal year [year]
+   * @param [in] latrad: Geodetic latitude [rad]
+   * @param [in] lonrad: Longitude [rad]
+   * @param [in] alt: Altitude [m]
+   * @param [in] calc_direct: Function to calculate the density directly with (decyear, latrad, lonrad, alt). It is used to fill the grid nodes.
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcAirDensity(const double decyear, const double latrad, const double lonrad, const double alt,
+                        const std::function<double(double, double, double, double)>& calc_direct);
+
+  // Getter
+  /**
+   * @fn GetNumCalculatedNodes
+   * @brief Return total number of the grid node calculations
+   */
+  inline size_t GetNumCalculatedNodes() const { return num_calculated_nodes_; }
+
+ private:
+  double update_period_year_;    //!< Period to discard the grid nodes [year]
+  double min_altitude_m_;        //!< Minimum altitude of the grid [m]
+  double max_altitude_m_;        //!< Maximum altitude of the grid [m]
+  double altitude_step_m_;       //!< Grid step of altitude [m]
+  double latitude_step_deg_;     //!< Grid step of latitude [deg]
+  double local_time_step_hour_;  //!< Grid step of local solar time [hour]
+  int num_altitude_;             //!< Number of grid nodes in altitude direction
+  int num_latitude_;             //!< Number of grid nodes in latitude direction (from -90 deg to 90 deg)
+  int num_local_time_;           //!< Number of grid nodes in local solar time direction (periodic)
+
+  bool is_epoch_set_ = false;   //!< Flag to show the grid epoch is set
+  double epoch_decyear_ = 0.0;  //!< Decimal year of the grid epoch [year]
+  double epoch_ut_hour_ = 0.0;  //!< Universal time of the day at the grid epoch [hour]
+
+  std::vector<double> log_density_;        //!< Logarithm of the density at the grid nodes (NAN when the density is not positive)
+  std::vector<uint32_t> node_generation_;  //!< Generation of the grid nodes. The node is calculated when it differs from generation_.
+  uint32_t generation_ = 0;                //!< Generation of the grid epoch
+  size_t num_calculated_nodes_ = 0;        //!< Total number of the grid node calculations
+
+  /**
+   * @fn GetNode
+   * @brief Return the logarithmic density at the grid node. The node is calculated when it is not calculated at the current epoch.
+   * @param [in] i_alt: Index of altitude
+   * @param [in] i_lat: Index of latitude
+   * @param [in] i_lst: Index of local solar time
+   * @param [in] calc_direct: Function to calculate the density directly
+   */
+  double GetNode(const int i_alt, const int i_lat, const int i_lst, const std::function<double(double, double, double, double)>& calc_direct);
+};
+
+#endif  //__ATMOSPHERE_DENSITY_GRID_H__
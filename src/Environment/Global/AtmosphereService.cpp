@@ -0,0 +1,236 @@
+/**
+ * @file AtmosphereService.cpp
+ * @brief Atmospheric density service shared by all spacecraft in the global environment
+ */
+
+#include "AtmosphereService.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+
+AtmosphereService::AtmosphereService(const string model, const string table_path, const bool is_manual_param_used, const double manual_f107,
+                                     const double manual_f107a, const double manual_ap, const bool is_interpolated, const double start_decyear,
+                                     const double end_sec)
+    : is_manual_param_used_(is_manual_param_used), manual_daily_f107_(manual_f107), manual_average_f107_(manual_f107a), manual_ap_(manual_ap) {
+  if (model == "STANDARD") {
+    model_ = AtmosphereModel::Standard;
+  } else if (model == "NRLMSISE00") {
+    model_ = AtmosphereModel::Nrlmsise00;
+  } else {
+    model_ = AtmosphereModel::None;
+  }
+
+  if (model_ == AtmosphereModel::Nrlmsise00 && !is_manual_param_used_) {
+    table_ = SpaceWeatherTable::Load(table_path, start_decyear, end_sec, is_interpolated);
+    if (table_->size() == 0) {
+      cerr << "Air density of the atmosphere service is switched to STANDARD model" << endl;
+      model_ = AtmosphereModel::Standard;
+    }
+  } else {
+    table_ = make_shared<const SpaceWeatherTable>();
+  }
+}
+
+void AtmosphereService::SetDensityGrid(const double update_period_s, const double min_altitude_m, const double max_altitude_m,
+                                       const double altitude_step_m, const double latitude_step_rad, const double local_time_step_hour) {
+  grid_ = make_shared<AtmosphereDensityGrid>(update_period_s, min_altitude_m, max_altitude_m, altitude_step_m, latitude_step_rad,
+                                             local_time_step_hour);
+}
+
+double AtmosphereService::CalcAirDensity(const double decyear, const Vector<3>& lat_lon_alt) const {
+  vector<double> densities;
+  CalcDensities(vector<Vector<3>>(1, lat_lon_alt), decyear, densities);
+  return densities[0];
+}
+
+void AtmosphereService::CalcDensities(const vector<Vector<3>>& lat_lon_alts, const double decyear, vector<double>& densities) const {
+  const size_t num = lat_lon_alts.size();
+  densities.assign(num, 0.0);
+  if (!IsCalcEnabled || num == 0) return;
+
+  switch (model_) {
+    case AtmosphereModel::Standard:
+      for (size_t i = 0; i < num; i++) {
+        densities[i] = CalcStandard(lat_lon_alts[i][2]);
+      }
+      break;
+    case AtmosphereModel::Nrlmsise00: {
+      if (grid_ != nullptr) {
+        // The grid nodes are filled in the order of the positions, in the same way as the calculation of each position
+        auto calc_direct = [this](double decyear_, double latrad_, double lonrad_, double alt_) {
+          return CalcNrlmsise00Direct(decyear_, latrad_, lonrad_, alt_);
+        };
+        for (size_t i = 0; i < num; i++) {
+          densities[i] = grid_->CalcAirDensity(decyear, lat_lon_alts[i][0], lat_lon_alts[i][1], lat_lon_alts[i][2], calc_direct);
+        }
+        break;
+      }
+      vector<double> latrad(num), lonrad(num), alt(num);
+      for (size_t i = 0; i < num; i++) {
+        latrad[i] = lat_lon_alts[i][0];
+        lonrad[i] = lat_lon_alts[i][1];
+        alt[i] = lat_lon_alts[i][2];
+      }
+      CalcNRLMSISE00(decyear, &latrad[0], &lonrad[0], &alt[0], num, *table_, is_manual_param_used_, manual_daily_f107_, manual_average_f107_,
+                     manual_ap_, &densities[0]);
+      break;
+    }
+    default:
+      // No suitable model
+      break;
+  }
+}
+
+void AtmosphereService::UpdateDensities(const vector<Vector<3>>& lat_lon_alts, const double decyear) {
+  batch_decyear_ = decyear;
+  batch_lat_lon_alts_ = lat_lon_alts;
+  CalcDensities(batch_lat_lon_alts_, batch_decyear_, batch_densities_);
+}
+
+double AtmosphereService::GetAirDensity(const int sat_id, const double decyear, const Vector<3>& lat_lon_alt) const {
+  if (sat_id >= 0 && (size_t)sat_id < batch_densities_.size() && decyear == batch_decyear_) {
+    const Vector<3>& batch_lat_lon_alt = batch_lat_lon_alts_[sat_id];
+    if (batch_lat_lon_alt[0] == lat_lon_alt[0] && batch_lat_lon_alt[1] == lat_lon_alt[1] && batch_lat_lon_alt[2] == lat_lon_alt[2]) {
+      return batch_densities_[sat_id];
+    }
+  }
+  return CalcAirDensity(decyear, lat_lon_alt);
+}
+
+double AtmosphereService::CalcNrlmsise00Direct(const double decyear, const double latrad, const double lonrad, const double alt) const {
+  return CalcNRLMSISE00(decyear, latrad, lonrad, alt, *table_, is_manual_param_used_, manual_daily_f107_, manual_average_f107_, manual_ap_);
+}
+
+double AtmosphereService::CalcStandard(const double altitude_m) {
+  // altitude_mの単位は[m]
+  double altitude = altitude_m / 1000.0;  // Convert to km
+  double scaleHeight;                     // [km]
+  double baseHeight;                      // [km]
+  double baseRho;                         // [kg/m^3]
+
+  // scaleHeight values: Ref "ミッション解析と軌道設計の基礎" (in Japanese)
+  if (altitude > 1000.0) {
+    scaleHeight = 268.0;
+    baseHeight = 1000.0;
+    baseRho = 3.019E-15;
+  } else if (altitude >= 900.0 && altitude < 1000.0) {
+    scaleHeight = 181.05;
+    baseHeight = 900.0;
+    baseRho = 5.245E-15;
+  } else if (altitude >= 800.0 && altitude < 900.0) {
+    scaleHeight = 124.64;
+    baseHeight = 800.0;
+    baseRho = 1.170E-14;
+  } else if (altitude >= 700.0 && altitude < 800.0) {
+    scaleHeight = 88.667;
+    baseHeight = 700.0;
+    baseRho = 3.614E-14;
+  } else if (altitude >= 600.0 && altitude < 700.0) {
+    scaleHeight = 71.835;
+    baseHeight = 600.0;
+    baseRho = 1.454E-13;
+  } else if (altitude >= 500.0 && altitude < 600.0) {
+    scaleHeight = 63.822;
+    baseHeight = 500.0;
+    baseRho = 6.967E-13;
+  } else if (altitude >= 450.0 && altitude < 500.0) {
+    scaleHeight = 60.828;
+    baseHeight = 450.0;
+    baseRho = 1.585E-12;
+  } else if (altitude >= 400.0 && altitude < 450.0) {
+    scaleHeight = 58.515;
+    baseHeight = 400.0;
+    baseRho = 3.725E-12;
+  } else if (altitude >= 350.0 && altitude < 400.0) {
+    scaleHeight = 53.298;
+    baseHeight = 350.0;
+    baseRho = 9.158E-12;
+  } else if (altitude >= 300.0 && altitude < 350.0) {
+    scaleHeight = 53.628;
+    baseHeight = 300.0;
+    baseRho = 2.418E-11;
+  } else if (altitude >= 250.0 && altitude < 300.0) {
+    scaleHeight = 45.546;
+    baseHeight = 250.0;
+    baseRho = 7.248E-11;
+  } else if (altitude >= 200.0 && altitude < 250.0) {
+    scaleHeight = 37.105;
+    baseHeight = 200.0;
+    baseRho = 2.789E-10;
+  } else if (altitude >= 180.0 && altitude < 200.0) {
+    scaleHeight = 29.740;
+    baseHeight = 180.0;
+    baseRho = 5.464E-10;
+  } else if (altitude >= 150.0 && altitude < 180.0) {
+    scaleHeight = 22.523;
+    baseHeight = 150.0;
+    baseRho = 2.070E-9;
+  } else if (altitude >= 140.0 && altitude < 150.0) {
+    scaleHeight = 16.149;
+    baseHeight = 140.0;
+    baseRho = 3.845E-9;
+  } else if (altitude >= 130.0 && altitude < 140.0) {
+    scaleHeight = 12.636;
+    baseHeight = 130.0;
+    baseRho = 8.484E-9;
+  } else if (altitude >= 120.0 && altitude < 130.0) {
+    scaleHeight = 9.473;
+    baseHeight = 120.0;
+    baseRho = 2.438E-8;
+  } else if (altitude >= 110.0 && altitude < 120.0) {
+    scaleHeight = 7.263;
+    baseHeight = 110.0;
+    baseRho = 9.661E-8;
+  } else if (altitude >= 100.0 && altitude < 110.0) {
+    scaleHeight = 5.877;
+    baseHeight = 100.0;
+    baseRho = 5.297E-7;
+  } else if (altitude >= 90.0 && altitude < 100.0) {
+    scaleHeight = 5.382;
+    baseHeight = 90.0;
+    baseRho = 3.396E-6;
+  } else if (altitude >= 80.0 && altitude < 90.0) {
+    scaleHeight = 5.799;
+    baseHeight = 80.0;
+    baseRho = 1.905E-5;
+  } else if (altitude >= 70.0 && altitude < 80.0) {
+    scaleHeight = 6.549;
+    baseHeight = 70.0;
+    baseRho = 8.770E-5;
+  } else if (altitude >= 60.0 && altitude < 70.0) {
+    scaleHeight = 7.714;
+    baseHeight = 60.0;
+    baseRho = 3.206E-4;
+  } else if (altitude >= 50.0 && altitude < 60.0) {
+    scaleHeight = 8.382;
+    baseHeight = 50.0;
+    baseRho = 1.057E-3;
+  } else if (altitude >= 40.0 && altitude < 50.0) {
+    scaleHeight = 7.554;
+    baseHeight = 40.0;
+    baseRho = 3.972E-3;
+  } else if (altitude >= 30.0 && altitude < 40.0) {
+    scaleHeight = 6.682;
+    baseHeight = 30.0;
+    baseRho = 1.774E-2;
+  } else if (altitude >= 25.0 && altitude < 30.0) {
+    scaleHeight = 6.349;
+    baseHeight = 25.0;
+    baseRho = 3.899E-2;
+  } else if (altitude >= 0.0 && altitude < 25.0) {
+    scaleHeight = 7.249;
+    baseHeight = 0.0;
+    baseRho = 1.225;
+  } else {  // In case of altitude is minus value
+    scaleHeight = 7.249;
+    baseHeight = 0.0;
+    baseRho = 0.0;
+    return 0.0;
+  }
+
+  double rho = baseRho * exp(-(altitude - baseHeight) / scaleHeight);
+  return rho;
+}
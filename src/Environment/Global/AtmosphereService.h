@@ -0,0 +1,147 @@
+/**
+ * @file AtmosphereService.h
+ * @brief Atmospheric density service shared by all spacecraft in the global environment
+ */
+
+#ifndef __ATMOSPHERE_SERVICE_H__
+#define __ATMOSPHERE_SERVICE_H__
+
+#include <Library/math/Vector.hpp>
+#include <Library/nrlmsise00/Wrapper_nrlmsise00.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AtmosphereDensityGrid.h"
+
+using libra::Vector;
+
+/**
+ * @enum AtmosphereModel
+ * @brief Atmospheric density model
+ */
+enum class AtmosphereModel {
+  Standard,    //!< Model using scale height
+  Nrlmsise00,  //!< NRLMSISE00 model
+  None,        //!< No model. The density is zero.
+};
+
+/**
+ * @class AtmosphereService
+ * @brief Atmospheric density service shared by all spacecraft in the global environment
+ * @note The space weather table and the density grid are set up once and shared by all spacecraft. The Atmosphere of each spacecraft reads
+ *       its density with GetAirDensity and adds its own density noise.
+ *       The simulation case can calculate the densities of all spacecraft in a step at once with UpdateDensities before the spacecraft are
+ *       updated. A spacecraft whose position is not in the batch of the step is calculated alone, and the result is the same.
+ *       The density grid and the batch of the step are caches, so the calculation functions are const but not thread safe.
+ */
+class AtmosphereService {
+ public:
+  bool IsCalcEnabled = true;  //!< Calculation enable flag
+
+  /**
+   * @fn AtmosphereService
+   * @brief Constructor
+   * @param [in] model: Atmospheric density model name
+   * @param [in] table_path: Path to the space weather table file
+   * @param [in] is_manual_param_used: Flag to use manual parameters
+   * @param [in] manual_f107: Manual value of daily F10.7
+   * @param [in] manual_f107a: Manual value of averaged F10.7 (3-month averaged value)
+   * @param [in] manual_ap: Manual value of ap value
+   * @param [in] is_interpolated: Flag to interpolate the space weather parameters between the table rows
+   * @param [in] start_decyear: Decimal year of the simulation start [year]
+   * @param [in] end_sec: End time of simulation [sec]
+   */
+  AtmosphereService(const std::string model, const std::string table_path, const bool is_manual_param_used, const double manual_f107,
+                    const double manual_f107a, const double manual_ap, const bool is_interpolated, const double start_decyear, const double end_sec);
+
+  /**
+   * @fn SetDensityGrid
+   * @brief Use the grid cache to calculate the density of the NRLMSISE00 model
+   * @param [in] update_period_s: Period to discard the grid nodes [s]
+   * @param [in] min_altitude_m: Minimum altitude of the grid [m]
+   * @param [in] max_altitude_m: Maximum altitude of the grid [m]
+   * @param [in] altitude_step_m: Grid step of altitude [m]
+   * @param [in] latitude_step_rad: Grid step of latitude [rad]
+   * @param [in] local_time_step_hour: Grid step of local solar time [hour]
+   */
+  void SetDensityGrid(const double update_period_s, const double min_altitude_m, const double max_altitude_m, const double altitude_step_m,
+                      const double latitude_step_rad, const double local_time_step_hour);
+
+  /**
+   * @fn CalcAirDensity
+   * @brief Calculate atmospheric density
+   * @param [in] decyear: Decimal year [year]
+   * @param [in] lat_lon_alt: Latitude[rad], longitude[rad], and altitude[m]
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcAirDensity(const double decyear, const Vector<3>& lat_lon_alt) const;
+  /**
+   * @fn CalcDensities
+   * @brief Calculate atmospheric densities of multiple spacecraft at the same time
+   * @note The space weather parameters and the time of the model are evaluated once for all spacecraft.
+   *       The results are the same as CalcAirDensity called for each position in the order.
+   * @param [in] lat_lon_alts: Latitude[rad], longitude[rad], and altitude[m] of the spacecraft
+   * @param [in] decyear: Decimal year [year]
+   * @param [out] densities: Atmospheric densities [kg/m^3]
+   */
+  void CalcDensities(const std::vector<Vector<3>>& lat_lon_alts, const double decyear, std::vector<double>& densities) const;
+  /**
+   * @fn UpdateDensities
+   * @brief Calculate atmospheric densities of all spacecraft in the step at once and keep them for GetAirDensity
+   * @param [in] lat_lon_alts: Latitude[rad], longitude[rad], and altitude[m] of the spacecraft. The index is the spacecraft ID.
+   * @param [in] decyear: Decimal year [year]
+   */
+  void UpdateDensities(const std::vector<Vector<3>>& lat_lon_alts, const double decyear);
+  /**
+   * @fn GetAirDensity
+   * @brief Return atmospheric density of a spacecraft
+   * @note The result of UpdateDensities is returned when it was calculated at the same time and position. Otherwise, it is calculated.
+   * @param [in] sat_id: Spacecraft ID
+   * @param [in] decyear: Decimal year [year]
+   * @param [in] lat_lon_alt: Latitude[rad], longitude[rad], and altitude[m]
+   * @return Atmospheric density [kg/m^3]
+   */
+  double GetAirDensity(const int sat_id, const double decyear, const Vector<3>& lat_lon_alt) const;
+
+  /**
+   * @fn CalcStandard
+   * @brief Calculate atmospheric density with simplest method
+   * @param [in] altitude_m: Altitude of spacecraft [m]
+   * @return Atmospheric density [kg/m^3]
+   */
+  static double CalcStandard(const double altitude_m);
+
+  // Getter
+  /**
+   * @fn GetModel
+   * @brief Return atmospheric density model
+   */
+  inline AtmosphereModel GetModel() const { return model_; }
+  /**
+   * @fn GetSpaceWeatherTable
+   * @brief Return the space weather table
+   */
+  inline const std::shared_ptr<const SpaceWeatherTable>& GetSpaceWeatherTable() const { return table_; }
+
+ private:
+  AtmosphereModel model_;                           //!< Atmospheric density model
+  std::shared_ptr<const SpaceWeatherTable> table_;  //!< Space weather table shared in the process
+  bool is_manual_param_used_;                       //!< Flag to use manual parameters
+  double manual_daily_f107_;                        //!< Manual daily f10.7 value
+  double manual_average_f107_;                      //!< Manual 3-month averaged f10.7 value
+  double manual_ap_;                                //!< Manual ap value
+
+  std::shared_ptr<AtmosphereDensityGrid> grid_;  //!< Grid cache of the NRLMSISE00 density (nullptr for the direct calculation)
+  double batch_decyear_ = 0.0;                   //!< Decimal year of the batch of the step [year]
+  std::vector<Vector<3>> batch_lat_lon_alts_;    //!< Positions of the batch of the step
+  std::vector<double> batch_densities_;          //!< Atmospheric densities of the batch of the step [kg/m^3]
+
+  /**
+   * @fn CalcNrlmsise00Direct
+   * @brief Calculate the density of the NRLMSISE00 model without the grid
+   */
+  double CalcNrlmsise00Direct(const double decyear, const double latrad, const double lonrad, const double alt) const;
+};
+
+#endif  //__ATMOSPHERE_SERVICE_H__
@@ -1,13 +1,12 @@
 /**
  * @file CelestialInformation.cpp
  * @brief Class to manage the information related with the celestial bodies
- * @details This class uses SPICE to get the information of celestial bodies
+ * @details This class is a per-case view of the EphemerisService shared in the process
  */
 
 #include "CelestialInformation.h"
 
 #include <Interface/LogOutput/LogUtility.h>
-#include <SpiceUsr.h>
 #include <string.h>
 
 #include <iostream>
@@ -15,107 +14,57 @@
 
 using namespace std;
 
-CelestialInformation::CelestialInformation(string inertial_frame, string aber_cor, string center_obj, RotationMode rotation_mode,
-                                           int num_of_selected_body, int* selected_body)
-    : num_of_selected_body_(num_of_selected_body),
-      selected_body_(selected_body),
-      inertial_frame_(inertial_frame),
-      aber_cor_(aber_cor),
-      center_obj_(center_obj),
-      rotation_mode_(rotation_mode) {
+CelestialInformation::CelestialInformation(shared_ptr<const EphemerisService> ephemeris_service, RotationMode rotation_mode)
+    : ephemeris_service_(ephemeris_service), num_of_selected_body_(ephemeris_service->GetNumBody()), rotation_mode_(rotation_mode) {
   // Initialize list
   int num_of_state = num_of_selected_body_ * 3;
   celes_objects_pos_from_center_i_ = new double[num_of_state];
   celes_objects_vel_from_center_i_ = new double[num_of_state];
-  celes_objects_gravity_constant_ = new double[num_of_selected_body_];
-  celes_objects_planetographic_radii_m_ = new double[num_of_state];
-  celes_objects_mean_radius_m_ = new double[num_of_selected_body_];
-
-  // Acquisition of gravity constant
-  for (int i = 0; i < num_of_selected_body_; i++) {
-    SpiceInt planet_id = selected_body_[i];
-    SpiceInt dim;
-    SpiceDouble gravity_constant;
-    bodvcd_c(planet_id, "GM", 1, &dim, &gravity_constant);
-    // Convert unit [km^3/s^2] to [m^3/s^2]
-    celes_objects_gravity_constant_[i] = gravity_constant * 1E+9;
-  }
-
-  // Acquisition of radius
-  for (int i = 0; i < num_of_selected_body_; i++) {
-    SpiceInt planet_id = selected_body_[i];
-    SpiceInt dim;
-    SpiceDouble radii_km[3];
-
-    bodvcd_c(planet_id, "RADII", 3, &dim, (SpiceDouble*)radii_km);
-    for (int j = 0; j < 3; j++) {
-      celes_objects_planetographic_radii_m_[i * 3 + j] = radii_km[j] * 1000.0;
-    }
-
-    double rx = celes_objects_planetographic_radii_m_[i * 3];
-    double ry = celes_objects_planetographic_radii_m_[i * 3 + 1];
-    double rz = celes_objects_planetographic_radii_m_[i * 3 + 2];
-
-    celes_objects_mean_radius_m_[i] = pow(rx * ry * rz, 1.0 / 3.0);
-  }
+  spice_states_.resize(num_of_selected_body_ * 6);
 
   // Initialize rotation
-  EarthRotation_ = new CelestialRotation(rotation_mode_, center_obj_);
+  EarthRotation_ = new CelestialRotation(rotation_mode_, GetCenterBodyName());
 }
 
 CelestialInformation::CelestialInformation(const CelestialInformation& obj)
-    : num_of_selected_body_(obj.num_of_selected_body_),
-      inertial_frame_(obj.inertial_frame_),
-      aber_cor_(obj.aber_cor_),
-      center_obj_(obj.center_obj_),
-      rotation_mode_(obj.rotation_mode_) {
+    : ephemeris_service_(obj.ephemeris_service_),
+      num_of_selected_body_(obj.num_of_selected_body_),
+      rotation_mode_(obj.rotation_mode_),
+      ephemeris_method_(obj.ephemeris_method_),
+      chebyshev_segment_length_day_(obj.chebyshev_segment_length_day_),
+      chebyshev_degree_(obj.chebyshev_degree_),
+      chebyshev_ephemeris_(obj.chebyshev_ephemeris_),
+      spice_states_(obj.spice_states_) {
   int num_of_state = num_of_selected_body_ * 3;
   int sd = sizeof(double);
-  int si = sizeof(int);
 
-  selected_body_ = new int[num_of_selected_body_];
   celes_objects_pos_from_center_i_ = new double[num_of_state];
   celes_objects_vel_from_center_i_ = new double[num_of_state];
-  celes_objects_gravity_constant_ = new double[num_of_selected_body_];
-  celes_objects_planetographic_radii_m_ = new double[num_of_state];
-  celes_objects_mean_radius_m_ = new double[num_of_selected_body_];
 
-  memcpy(selected_body_, obj.selected_body_, si * num_of_selected_body_);
   memcpy(celes_objects_pos_from_center_i_, obj.celes_objects_pos_from_center_i_, sd * num_of_state);
   memcpy(celes_objects_vel_from_center_i_, obj.celes_objects_vel_from_center_i_, sd * num_of_state);
-  memcpy(celes_objects_gravity_constant_, obj.celes_objects_gravity_constant_, sd * num_of_selected_body_);
-  memcpy(celes_objects_planetographic_radii_m_, obj.celes_objects_planetographic_radii_m_, sd * num_of_state);
-  memcpy(celes_objects_mean_radius_m_, obj.celes_objects_mean_radius_m_, sd * num_of_selected_body_);
+
+  EarthRotation_ = new CelestialRotation(*obj.EarthRotation_);
 }
 
 CelestialInformation::~CelestialInformation() {
   delete[] celes_objects_pos_from_center_i_;
   delete[] celes_objects_vel_from_center_i_;
-  delete[] celes_objects_gravity_constant_;
-  delete[] celes_objects_planetographic_radii_m_;
-  delete[] celes_objects_mean_radius_m_;
-  delete[] selected_body_;
   delete EarthRotation_;
 }
 
 void CelestialInformation::UpdateAllObjectsInfo(const double current_jd) {
-  // Convert time
-  SpiceDouble et;
-  string jd = "jd " + to_string(current_jd);
-  str2et_c(jd.c_str(), &et);
+  const bool use_chebyshev = chebyshev_ephemeris_ != nullptr && chebyshev_ephemeris_->IsInRange(current_jd);
+  if (!use_chebyshev) ephemeris_service_->GetStatesFromSpice(current_jd, spice_states_.data());
 
   for (int i = 0; i < num_of_selected_body_; i++) {
-    SpiceInt planet_id = selected_body_[i];
-
-    // Acquisition of body name from id
-    SpiceBoolean found;
-    const int maxlen = 100;
-    char namebuf[maxlen];
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-
     // Acquisition of position and velocity
-    SpiceDouble rv_buf[6];
-    GetPlanetOrbit(namebuf, et, (SpiceDouble*)rv_buf);
+    double rv_buf[6];
+    if (use_chebyshev) {
+      chebyshev_ephemeris_->Evaluate(i, current_jd, rv_buf);
+    } else {
+      for (int j = 0; j < 6; j++) rv_buf[j] = spice_states_[i * 6 + j];
+    }
     // Convert unit [km], [km/s] to [m], [m/s]
     for (int j = 0; j < 3; j++) {
       celes_objects_pos_from_center_i_[i * 3 + j] = rv_buf[j] * 1000.0;
@@ -127,6 +76,18 @@ void CelestialInformation::UpdateAllObjectsInfo(const double current_jd) {
   EarthRotation_->Update(current_jd);
 }
 
+void CelestialInformation::SetEphemerisMethod(const EphemerisMethod method, const double segment_length_day, const int degree) {
+  ephemeris_method_ = method;
+  chebyshev_segment_length_day_ = segment_length_day;
+  chebyshev_degree_ = degree;
+  chebyshev_ephemeris_ = nullptr;
+}
+
+void CelestialInformation::PrecomputeEphemeris(const double start_jd, const double end_jd) {
+  if (ephemeris_method_ != EphemerisMethod::Chebyshev) return;
+  chebyshev_ephemeris_ = ephemeris_service_->GetChebyshevEphemeris(start_jd, end_jd, chebyshev_segment_length_day_, chebyshev_degree_);
+}
+
 // Getters
 Vector<3> CelestialInformation::GetPosFromCenter_i(const int id) const {
   Vector<3> pos(0.0);
@@ -152,17 +113,20 @@ Vector<3> CelestialInformation::GetVelFromCenter_i(const char* body_name) const
   return GetVelFromCenter_i(id);
 }
 
+double CelestialInformation::GetGravityConstant(const int id) const { return ephemeris_service_->GetGravityConstant(id); }
+
 double CelestialInformation::GetGravityConstant(const char* body_name) const {
   int index = CalcBodyIdFromName(body_name);
-  return celes_objects_gravity_constant_[index];
+  return GetGravityConstant(index);
 }
 
-double CelestialInformation::GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant(center_obj_.c_str()); }
+double CelestialInformation::GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant(GetCenterBodyId()); }
 
 Vector<3> CelestialInformation::GetRadii(const int id) const {
   Vector<3> radii(0.0);
   if (id > num_of_selected_body_) return radii;
-  for (int i = 0; i < 3; i++) radii[i] = celes_objects_planetographic_radii_m_[id * 3 + i];
+  const double* radii_m = ephemeris_service_->GetPlanetographicRadii(id);
+  for (int i = 0; i < 3; i++) radii[i] = radii_m[i];
   return radii;
 }
 
@@ -171,20 +135,24 @@ Vector<3> CelestialInformation::GetRadiiFromName(const char* body_name) const {
   return GetRadii(id);
 }
 
+double CelestialInformation::GetMeanRadius(const int id) const { return ephemeris_service_->GetMeanRadius(id); }
+
 double CelestialInformation::GetMeanRadiusFromName(const char* body_name) const {
   int index = CalcBodyIdFromName(body_name);
-  return celes_objects_mean_radius_m_[index];
+  return GetMeanRadius(index);
 }
 
 int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
-  int index = 0;
-  SpiceInt planet_id;
-  SpiceBoolean found;
-
-  // Acquisition of ID from body name
-  bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  int index = ephemeris_service_->FindBodyId(body_name);
+  if (index >= 0) return index;
+
+  // Names which are not in the table (e.g. aliases) are resolved by SPICE
+  index = 0;
+  int planet_id;
+  if (!EphemerisService::FindSpiceId(body_name, planet_id)) return index;
+  const int* selected_body = GetSelectedBody();
   for (int i = 0; i < num_of_selected_body_; i++) {
-    if (selected_body_[i] == planet_id) {
+    if (selected_body[i] == planet_id) {
       index = i;
       break;
     }
@@ -192,74 +160,39 @@ int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   return index;
 }
 
-string CelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int maxlen = 100;
-  char namebuf[maxlen];
-  string str_tmp = "";
+void CelestialInformation::GetLogSchema(LogSchema& schema) const {
   for (int i = 0; i < num_of_selected_body_; i++) {
-    SpiceInt planet_id = selected_body_[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    string name = namebuf;
-    string body_pos = name + "_pos";
-    string body_vel = name + "_vel";
+    const string& name = GetBodyName(i);
     //　OUTPUT ONLY POS/VEL LOOKED FROM S/C AT THIS MOMENT
-    str_tmp += WriteVector(body_pos, "i", "m", 3);
-    str_tmp += WriteVector(body_vel, "i", "m/s", 3);
+    schema.AddVector(name + "_pos", "i", "m", 3);
+    schema.AddVector(name + "_vel", "i", "m/s", 3);
+  }
+  if (EarthRotation_->GetRotationMode() == Full && EarthRotation_->GetPrecessionNutationUpdateIntervalSec() > 0.0) {
+    schema.AddScalar("earth_rotation_interpolation_error", "rad");
   }
-  return str_tmp;
 }
 
-string CelestialInformation::GetLogValue() const {
-  string str_tmp = "";
+void CelestialInformation::LogValues(LogSink& sink) const {
   for (int i = 0; i < num_of_selected_body_; i++) {
     //　OUTPUT ONLY POS/VEL LOOKED FROM S/C AT THIS MOMENT
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celes_objects_pos_from_center_i_[i * 3 + j]);
+      sink.Add(celes_objects_pos_from_center_i_[i * 3 + j]);
     }
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celes_objects_vel_from_center_i_[i * 3 + j]);
+      sink.Add(celes_objects_vel_from_center_i_[i * 3 + j]);
     }
   }
-  return str_tmp;
+  if (EarthRotation_->GetRotationMode() == Full && EarthRotation_->GetPrecessionNutationUpdateIntervalSec() > 0.0) {
+    sink.Add(EarthRotation_->GetPrecessionNutationErrorRad());
+  }
 }
 
 void CelestialInformation::DebugOutput(void) {
-  SpiceBoolean found;
-  const int maxlen = 100;
-  char namebuf[maxlen];
   cout << "BODY NAME, POSx,y,z[m], VELx,y,z[m/s] from CENTER;\nPOSx,y,z[m], "
           "VELx,y,z[m/s] from SC";
-  for (int i = 0; i < num_of_selected_body_; i++) {
-    SpiceInt planet_id = selected_body_[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    //		cout<<namebuf<<
-  }
   cout << "GRAVITY CONSTASNT of\n";
   for (int i = 0; i < num_of_selected_body_; i++) {
-    SpiceInt planet_id = selected_body_[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    cout << namebuf << "is"
-         << ": " << celes_objects_gravity_constant_[i] << "\n";
+    cout << GetBodyName(i) << "is"
+         << ": " << GetGravityConstant(i) << "\n";
   }
 }
-
-void CelestialInformation::GetPlanetOrbit(const char* planet_name, double et, double orbit[6]) {
-  // Add `BARYCENTER` if needed
-  const int maxlen = 100;
-  char planet_name_[maxlen];
-  strcpy(planet_name_, planet_name);
-  if (strcmp(planet_name, "MARS") == 0 || strcmp(planet_name, "JUPITER") == 0 || strcmp(planet_name, "SATURN") == 0 ||
-      strcmp(planet_name, "URANUS") == 0 || strcmp(planet_name, "NEPTUNE") == 0 || strcmp(planet_name, "PLUTO") == 0) {
-    strcat(planet_name_, "_BARYCENTER");
-  }
-
-  // Get orbit
-  SpiceDouble lt;
-  spkezr_c((ConstSpiceChar*)planet_name_, (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_.c_str(), (ConstSpiceChar*)aber_cor_.c_str(),
-           (ConstSpiceChar*)center_obj_.c_str(), (SpiceDouble*)orbit, (SpiceDouble*)&lt);
-  return;
-}
@@ -1,16 +1,21 @@
 /**
  * @file CelestialInformation.h
  * @brief Class to manage the information related with the celestial bodies
- * @details This class uses SPICE to get the information of celestial bodies
+ * @details This class is a per-case view of the EphemerisService shared in the process
  */
 
 #ifndef __celestial_information_H__
 #define __celestial_information_H__
 
 #include <cstring>
+#include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "CelestialRotation.h"
+#include "ChebyshevEphemeris.h"
+#include "EphemerisService.h"
 #include "Interface/LogOutput/ILoggable.h"
 #include "Library/math/MatVec.hpp"
 #include "Library/math/Matrix.hpp"
@@ -20,25 +25,30 @@
 using libra::Quaternion;
 using libra::Vector;
 
+/**
+ * @enum EphemerisMethod
+ * @brief Calculation method of the ephemerides
+ */
+enum class EphemerisMethod {
+  Spice,      //!< Call SPICE at every update
+  Chebyshev,  //!< Piecewise Chebyshev polynomials fitted with SPICE over the simulation time span
+};
+
 /**
  * @class CelestialInformation
  * @brief Class to manage the information related with the celestial bodies
- * @details This class uses SPICE to get the information of celestial bodies
+ * @details This class is a per-case view of the EphemerisService shared in the process. It only keeps the states of the bodies
+ *          at the current time and the rotation of the center body, so instances can be updated in parallel threads.
  */
 class CelestialInformation : public ILoggable {
  public:
   /**
    * @fn CelestialInformation
    * @brief Constructor
-   * @param [in] inertial_frame:  Definition of inertial frame
-   * @param [in] aber_cor: Stellar aberration correction
-   * @param [in] center_obj: Center object of inertial frame
+   * @param [in] ephemeris_service: Ephemeris service shared in the process
    * @param [in] rotation_mode: Designation of rotation model
-   * @param [in] num_of_selected_body: Number of selected body
-   * @param [in] selected_body: SPICE IDs of selected bodies
    */
-  CelestialInformation(std::string inertial_frame, std::string aber_cor, std::string center_obj, RotationMode rotation_mode, int num_of_selected_body,
-                       int* selected_body);
+  CelestialInformation(std::shared_ptr<const EphemerisService> ephemeris_service, RotationMode rotation_mode);
   /**
    * @fn CelestialInformation
    * @brief Copy constructor
@@ -52,15 +62,15 @@ class CelestialInformation : public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
   /**
    * @fn UpdateAllObjectsInfo
@@ -68,6 +78,24 @@ class CelestialInformation : public ILoggable {
    */
   void UpdateAllObjectsInfo(const double current_jd);
 
+  /**
+   * @fn SetEphemerisMethod
+   * @brief Set calculation method of the ephemerides
+   * @param [in] method: Calculation method of the ephemerides
+   * @param [in] segment_length_day: Length of a Chebyshev segment [day]
+   * @param [in] degree: Degree of the Chebyshev polynomials
+   */
+  void SetEphemerisMethod(const EphemerisMethod method, const double segment_length_day, const int degree);
+  /**
+   * @fn PrecomputeEphemeris
+   * @brief Fit the Chebyshev ephemerides over the simulation time span with SPICE when the Chebyshev method is selected
+   * @note The fitted polynomials are shared with the other cases through the EphemerisService.
+   *       SPICE is still used when the Julian day is out of the fitted time span.
+   * @param [in] start_jd: Start of the simulation [Julian day]
+   * @param [in] end_jd: End of the simulation [Julian day]
+   */
+  void PrecomputeEphemeris(const double start_jd, const double end_jd);
+
   // Getters
   // Orbit information
   /**
@@ -96,6 +124,12 @@ class CelestialInformation : public ILoggable {
   Vector<3> GetVelFromCenter_i(const char* body_name) const;
 
   // Gravity constants
+  /**
+   * @fn GetGravityConstant
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  double GetGravityConstant(const int id) const;
   /**
    * @fn GetGravityConstant
    * @brief Return gravity constant of the celestial body [m^3/s^2]
@@ -122,10 +156,16 @@ class CelestialInformation : public ILoggable {
    */
   Vector<3> GetRadiiFromName(const char* body_name) const;
   /**
-   * @fn GetMeanRadiusFromName
+   * @fn GetMeanRadius
    * @brief Return mean radius of a celestial body [m]
    * @param [in] id: ID of CelestialInformation list
    */
+  double GetMeanRadius(const int id) const;
+  /**
+   * @fn GetMeanRadiusFromName
+   * @brief Return mean radius of a celestial body [m]
+   * @param [in] body_name: Name of the body defined in the SPICE
+   */
   double GetMeanRadiusFromName(const char* body_name) const;
 
   // Parameters
@@ -138,24 +178,48 @@ class CelestialInformation : public ILoggable {
    * @fn GetSelectedBody
    * @brief Return SPICE IDs of selected bodies
    */
-  inline int* GetSelectedBody(void) const { return selected_body_; }
+  inline const int* GetSelectedBody(void) const { return ephemeris_service_->GetSelectedBody(); }
   /**
    * @fn GetCenterBodyName
    * @brief Return name of the center body
    */
-  inline std::string GetCenterBodyName(void) const { return center_obj_; }
+  inline std::string GetCenterBodyName(void) const { return ephemeris_service_->GetCenterBodyName(); }
+  /**
+   * @fn GetCenterBodyId
+   * @brief Return ID of the center body in the CelestialInformation list
+   */
+  inline int GetCenterBodyId(void) const { return ephemeris_service_->GetCenterBodyId(); }
+  /**
+   * @fn GetBodyName
+   * @brief Return name of the body defined in the SPICE
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline const std::string& GetBodyName(const int id) const { return ephemeris_service_->GetBodyName(id); }
+  /**
+   * @fn GetEphemerisService
+   * @brief Return the ephemeris service shared in the process
+   */
+  inline const EphemerisService& GetEphemerisService(void) const { return *ephemeris_service_; }
 
   // Members
   /**
    * @fn GetEarthRotation
    * @brief Return EarthRotation information
    */
-  inline CelestialRotation GetEarthRotation(void) const { return *EarthRotation_; };
+  inline const CelestialRotation& GetEarthRotation(void) const { return *EarthRotation_; };
+  /**
+   * @fn SetEarthPrecessionNutationUpdateInterval
+   * @brief Set update interval of the precession and nutation matrix of the Earth rotation
+   * @param [in] interval_sec: Update interval [sec]. Zero or negative value calculates them at every update.
+   */
+  inline void SetEarthPrecessionNutationUpdateInterval(const double interval_sec) { EarthRotation_->SetPrecessionNutationUpdateInterval(interval_sec); }
 
   // Calculation
   /**
    * @fn CalcBodyIdFromName
    * @brief Acquisition of ID of CelestialInformation list from body name
+   * @note The names of the selected bodies are resolved from the name table of the EphemerisService without SPICE.
+   *       Resolve the ID once in the initialization and use the ID based functions in the periodic calculation.
    * @param [in] body_name: Celestial body name
    * @return ID of CelestialInformation list
    */
@@ -167,36 +231,23 @@ class CelestialInformation : public ILoggable {
   void DebugOutput(void);
 
  private:
-  // Setting parameters
-  int num_of_selected_body_;    //!< Number of selected body
-  int* selected_body_;          //!< SPICE IDs of selected bodies
-  std::string inertial_frame_;  //!< Definition of inertial frame
-  std::string aber_cor_;        //!< Stellar aberration correction （Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt）
-  std::string center_obj_;      //!< Center object of inertial frame
+  std::shared_ptr<const EphemerisService> ephemeris_service_;  //!< Ephemeris service shared in the process
+  int num_of_selected_body_;                                   //!< Number of selected body
 
   // Calculated values
-  double* celes_objects_pos_from_center_i_;       //!< Position vector list at inertial frame [m]
-  double* celes_objects_vel_from_center_i_;       //!< Velocity vector list at inertial frame [m/s]
-  double* celes_objects_gravity_constant_;        //!< Gravity constant list [m^3/s^2]
-  double* celes_objects_mean_radius_m_;           //!< Mean radius list [m] r = (rx * ry * rz)^(1/3)
-  double* celes_objects_planetographic_radii_m_;  //!< 3 axis planetographic radii [m]
-                                                  // X-axis pass through the 0 degree latitude 0 degree longitude direction
-                                                  // Z-axis pass through the 90 degree latitude direction
-                                                  // Y-axis equal to the cross product of the unit Z-axis and X-axis vectors
+  double* celes_objects_pos_from_center_i_;  //!< Position vector list at inertial frame [m]
+  double* celes_objects_vel_from_center_i_;  //!< Velocity vector list at inertial frame [m/s]
 
   // Rotational Motion of each planets
   CelestialRotation* EarthRotation_;  //!< Instatnce of Earth rotation
   RotationMode rotation_mode_;        //!< Designation of rotation model
 
-  /**
-   * @fn GetPlanetOrbit
-   * @brief Get position/velocity of planet.
-   * @note This is an override function of SPICE's spkezr_c (https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkezr_c.html)
-   * @param [in] planet_name: Nama of planet defineed by SPICE
-   * @param [in] et: Ephemeris time
-   * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
-   */
-  void GetPlanetOrbit(const char* planet_name, double et, double orbit[6]);
+  // Ephemeris calculation
+  EphemerisMethod ephemeris_method_ = EphemerisMethod::Spice;      //!< Calculation method of the ephemerides
+  double chebyshev_segment_length_day_ = 1.0;                      //!< Length of a Chebyshev segment [day]
+  int chebyshev_degree_ = 12;                                      //!< Degree of the Chebyshev polynomials
+  std::shared_ptr<const ChebyshevEphemeris> chebyshev_ephemeris_;  //!< Fitted Chebyshev ephemerides (nullptr: not fitted)
+  std::vector<double> spice_states_;                               //!< Buffer of the states acquired from SPICE [km, km/s]
 };
 
 #endif  //__celestial_information_H__
@@ -130,28 +130,19 @@ void CelestialRotation::Update(const double JulianDate) {
   double gmst_rad = gstime(JulianDate);  // It is a bit different with 長沢(Nagasawa)'s algorithm. TODO: Check the correctness
 
   if (rotation_mode_ == Full) {
-    // Compute Julian date for terestrial time
-    double jdTT_day = JulianDate + dtUT1UTC_ * kSec2Day;  // TODO: Check the correctness. Problem is thtat S2E doesn't have Gregorian calendar.
-
-    // Compute nth power of julian century for terrestrial time the actual unit of tTT_century is [century^(i+1)], i is the index of the array
-    double tTT_century[4];
-    tTT_century[0] = (jdTT_day - kJulianDateJ2000) / kDayJulianCentury;
-    for (int i = 0; i < 3; i++) {
-      tTT_century[i + 1] = tTT_century[i] * tTT_century[0];
+    // Nutation + Precession
+    Matrix<3, 3> PN;
+    double Eq_rad;  // Equation of equinoxes [rad]
+    if (pn_update_interval_sec_ > 0.0) {
+      InterpolatePrecessionNutation(JulianDate, PN, Eq_rad);
+    } else {
+      CalcPrecessionNutation(JulianDate, PN, Eq_rad);
     }
 
-    Matrix<3, 3> P;
-    Matrix<3, 3> N;
     Matrix<3, 3> R;
     Matrix<3, 3> W;
-    // Nutation + Precession
-    P = Precession(tTT_century);
-    N = Nutation(tTT_century);  // epsi_rad_, depsilon_rad_, dpsi_rad_ are
-                                // updated in this proccedure
-
     // Axial Rotation
-    double Eq_rad = dpsi_rad_ * cos(epsi_rad_ + depsilon_rad_);  // Equation of equinoxes [rad]
-    double gast_rad = gmst_rad + Eq_rad;                         // Greenwitch 'Appearent' Sidereal Time [rad]
+    double gast_rad = gmst_rad + Eq_rad;  // Greenwitch 'Appearent' Sidereal Time [rad]
     R = AxialRotation(gast_rad);
     // Polar motion (isnot considered so far, even without polar motion, the result agrees well with the matlab reference)
     double Xp = 0.0;
@@ -159,7 +150,7 @@ void CelestialRotation::Update(const double JulianDate) {
     W = PolarMotion(Xp, Yp);
 
     // Total orientation
-    DCM_J2000toXCXF_ = W * R * N * P;
+    DCM_J2000toXCXF_ = W * R * PN;
   } else if (rotation_mode_ == Simple) {
     // In this case, only Axial Rotation is executed, with its argument replaced from G'A'ST to G'M'ST
     DCM_J2000toXCXF_ = AxialRotation(gmst_rad);
@@ -169,6 +160,74 @@ void CelestialRotation::Update(const double JulianDate) {
   }
 }
 
+void CelestialRotation::SetPrecessionNutationUpdateInterval(const double interval_sec) {
+  pn_update_interval_sec_ = interval_sec;
+  is_pn_node_set_ = false;
+  pn_interpolation_error_rad_ = 0.0;
+}
+
+void CelestialRotation::CalcPrecessionNutation(const double JulianDate, Matrix<3, 3>& PN, double& Eq_rad) {
+  // Compute Julian date for terestrial time
+  double jdTT_day = JulianDate + dtUT1UTC_ * kSec2Day;  // TODO: Check the correctness. Problem is thtat S2E doesn't have Gregorian calendar.
+
+  // Compute nth power of julian century for terrestrial time the actual unit of tTT_century is [century^(i+1)], i is the index of the array
+  double tTT_century[4];
+  tTT_century[0] = (jdTT_day - kJulianDateJ2000) / kDayJulianCentury;
+  for (int i = 0; i < 3; i++) {
+    tTT_century[i + 1] = tTT_century[i] * tTT_century[0];
+  }
+
+  Matrix<3, 3> P;
+  Matrix<3, 3> N;
+  P = Precession(tTT_century);
+  N = Nutation(tTT_century);  // epsi_rad_, depsilon_rad_, dpsi_rad_ are
+                              // updated in this proccedure
+  PN = N * P;
+
+  Eq_rad = dpsi_rad_ * cos(epsi_rad_ + depsilon_rad_);  // Equation of equinoxes [rad]
+}
+
+void CelestialRotation::InterpolatePrecessionNutation(const double JulianDate, Matrix<3, 3>& PN, double& Eq_rad) {
+  const double interval_day = pn_update_interval_sec_ * kSec2Day;
+  // The nodes are placed on a fixed grid from J2000 so that they do not depend on the start time
+  const double node_jd = kJulianDateJ2000 + floor((JulianDate - kJulianDateJ2000) / interval_day) * interval_day;
+
+  if (!is_pn_node_set_ || node_jd != pn_node_jd_[0]) {
+    if (is_pn_node_set_ && node_jd == pn_node_jd_[1]) {
+      // Move to the next interval
+      pn_node_jd_[0] = pn_node_jd_[1];
+      pn_node_[0] = pn_node_[1];
+      eq_node_rad_[0] = eq_node_rad_[1];
+    } else {
+      pn_node_jd_[0] = node_jd;
+      CalcPrecessionNutation(pn_node_jd_[0], pn_node_[0], eq_node_rad_[0]);
+    }
+    pn_node_jd_[1] = node_jd + interval_day;
+    CalcPrecessionNutation(pn_node_jd_[1], pn_node_[1], eq_node_rad_[1]);
+    is_pn_node_set_ = true;
+
+    // Evaluate the interpolation error at the middle of the interval, where the error of the linear interpolation is the largest
+    Matrix<3, 3> PN_mid;
+    double Eq_mid_rad;
+    CalcPrecessionNutation(node_jd + 0.5 * interval_day, PN_mid, Eq_mid_rad);
+    Matrix<3, 3> DCM_exact = AxialRotation(Eq_mid_rad) * PN_mid;
+    Matrix<3, 3> DCM_interpolated = AxialRotation(0.5 * (eq_node_rad_[0] + eq_node_rad_[1])) * (0.5 * (pn_node_[0] + pn_node_[1]));
+    Matrix<3, 3> DCM_error = DCM_exact - DCM_interpolated;
+    // For a small rotation error, the Frobenius norm of the difference is sqrt(2) times the rotation angle
+    double error_norm2 = 0.0;
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) {
+        error_norm2 += DCM_error[i][j] * DCM_error[i][j];
+      }
+    }
+    pn_interpolation_error_rad_ = sqrt(error_norm2 / 2.0);
+  }
+
+  const double t = (JulianDate - pn_node_jd_[0]) / interval_day;
+  PN = (1.0 - t) * pn_node_[0] + t * pn_node_[1];
+  Eq_rad = (1.0 - t) * eq_node_rad_[0] + t * eq_node_rad_[1];
+}
+
 Matrix<3, 3> CelestialRotation::AxialRotation(const double GAST_rad) { return libra::rotz(GAST_rad); }
 
 Matrix<3, 3> CelestialRotation::Nutation(const double (&tTT_century)[4]) {
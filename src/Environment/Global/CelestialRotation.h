@@ -67,6 +67,31 @@ class CelestialRotation {
    */
   inline const Matrix<3, 3> GetDCMTEMEtoXCXF() const { return DCM_TEMEtoXCXF_; };
 
+  /**
+   * @fn SetPrecessionNutationUpdateInterval
+   * @brief Set update interval of the precession and nutation matrix in the Full mode
+   * @note The product of the precession and nutation matrices and the equation of equinoxes vary on timescales of hours.
+   *       When the interval is positive, they are calculated only at the nodes separated by the interval and linearly interpolated
+   *       between the nodes. The axial rotation with GMST is still calculated at every update.
+   * @param [in] interval_sec: Update interval [sec]. Zero or negative value calculates them at every update.
+   */
+  void SetPrecessionNutationUpdateInterval(const double interval_sec);
+  /**
+   * @fn GetPrecessionNutationUpdateIntervalSec
+   * @brief Return update interval of the precession and nutation matrix [sec]
+   */
+  inline double GetPrecessionNutationUpdateIntervalSec() const { return pn_update_interval_sec_; }
+  /**
+   * @fn GetPrecessionNutationErrorRad
+   * @brief Return the interpolation error of the DCM evaluated at the middle of the latest interpolation interval [rad]
+   */
+  inline double GetPrecessionNutationErrorRad() const { return pn_interpolation_error_rad_; }
+  /**
+   * @fn GetRotationMode
+   * @brief Return rotation mode
+   */
+  inline RotationMode GetRotationMode() const { return rotation_mode_; }
+
  private:
   /**
    * @fn Init_CelestialRotation_As_Earth
@@ -82,6 +107,23 @@ class CelestialRotation {
   Matrix<3, 3> Precession(const double (&tTT_century)[4]);     //!< Movement of the coordinate axes due to Precession
   Matrix<3, 3> PolarMotion(const double Xp, const double Yp);  //!< Movement of the coordinate axes due to Polar Motion
 
+  /**
+   * @fn CalcPrecessionNutation
+   * @brief Calculate the product of the precession and nutation matrices and the equation of equinoxes
+   * @param [in] JulianDate: Julian date
+   * @param [out] PN: Product of the nutation and precession matrices N * P
+   * @param [out] Eq_rad: Equation of equinoxes [rad]
+   */
+  void CalcPrecessionNutation(const double JulianDate, Matrix<3, 3>& PN, double& Eq_rad);
+  /**
+   * @fn InterpolatePrecessionNutation
+   * @brief Interpolate the product of the precession and nutation matrices and the equation of equinoxes between the cached nodes
+   * @param [in] JulianDate: Julian date
+   * @param [out] PN: Product of the nutation and precession matrices N * P
+   * @param [out] Eq_rad: Equation of equinoxes [rad]
+   */
+  void InterpolatePrecessionNutation(const double JulianDate, Matrix<3, 3>& PN, double& Eq_rad);
+
   double dpsi_rad_;               //!< Nutation in obliquity [rad]
   double depsilon_rad_;           //!< Nutation in longitude [rad]
   double epsi_rad_;               //!< Mean obliquity of the ecliptic [rad]
@@ -90,6 +132,14 @@ class CelestialRotation {
   RotationMode rotation_mode_;    //!< Designation of dynamics model
   std::string planet_name_;       //!< Designate which solar planet the instance should work as
 
+  // Multi-rate update of the precession and nutation
+  double pn_update_interval_sec_ = 0.0;      //!< Update interval of the precession and nutation matrix [sec] (0: every update)
+  bool is_pn_node_set_ = false;              //!< Flag to show the interpolation nodes are calculated
+  double pn_node_jd_[2];                     //!< Julian dates of the interpolation nodes [day]
+  Matrix<3, 3> pn_node_[2];                  //!< Product of the nutation and precession matrices at the interpolation nodes
+  double eq_node_rad_[2];                    //!< Equation of equinoxes at the interpolation nodes [rad]
+  double pn_interpolation_error_rad_ = 0.0;  //!< Interpolation error of the DCM at the middle of the latest interval [rad]
+
   // Definitions of coefficeints
   // They are handling as constant values
   // TODO: Consider to read setting files for these coefficients
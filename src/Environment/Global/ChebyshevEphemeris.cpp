@@ -0,0 +1,78 @@
+/**
+ * @file ChebyshevEphemeris.cpp
+ * @brief Piecewise Chebyshev polynomial approximation of the ephemerides of celestial bodies
+ */
+
+#include "ChebyshevEphemeris.h"
+
+#include <Library/math/Constant.hpp>
+#include <cmath>
+
+using namespace std;
+
+ChebyshevEphemeris::ChebyshevEphemeris(const int num_of_body, const double segment_length_day, const int degree)
+    : num_of_body_(num_of_body), segment_length_day_(segment_length_day), degree_(degree) {}
+
+void ChebyshevEphemeris::Fit(const double start_jd, const double end_jd, const function<void(const int body_id, const double jd, double state[6])>& sample) {
+  const int num_of_node = degree_ + 1;
+  num_of_segment_ = (int)ceil((end_jd - start_jd) / segment_length_day_);
+  if (num_of_segment_ < 1) num_of_segment_ = 1;
+  start_jd_ = start_jd;
+  end_jd_ = start_jd + num_of_segment_ * segment_length_day_;
+  coefficients_.assign((size_t)num_of_segment_ * num_of_body_ * 6 * num_of_node, 0.0);
+
+  // cos(pi * k * (j + 0.5) / N) is common for all segments
+  vector<double> cos_table(num_of_node * num_of_node);
+  for (int k = 0; k < num_of_node; k++) {
+    for (int j = 0; j < num_of_node; j++) {
+      cos_table[k * num_of_node + j] = cos(libra::pi * k * (j + 0.5) / num_of_node);
+    }
+  }
+
+  vector<double> samples(num_of_node * 6);
+  for (int seg = 0; seg < num_of_segment_; seg++) {
+    const double mid_jd = start_jd_ + (seg + 0.5) * segment_length_day_;
+    for (int body = 0; body < num_of_body_; body++) {
+      // Sample at the Chebyshev nodes
+      for (int j = 0; j < num_of_node; j++) {
+        const double jd = mid_jd + 0.5 * segment_length_day_ * cos_table[1 * num_of_node + j];
+        sample(body, jd, &samples[j * 6]);
+      }
+      // Discrete Chebyshev transform
+      double* coeff = &coefficients_[((size_t)seg * num_of_body_ + body) * 6 * num_of_node];
+      for (int c = 0; c < 6; c++) {
+        for (int k = 0; k < num_of_node; k++) {
+          double sum = 0.0;
+          for (int j = 0; j < num_of_node; j++) sum += samples[j * 6 + c] * cos_table[k * num_of_node + j];
+          coeff[c * num_of_node + k] = 2.0 * sum / num_of_node;
+        }
+        coeff[c * num_of_node] *= 0.5;
+      }
+    }
+  }
+}
+
+bool ChebyshevEphemeris::Evaluate(const int body_id, const double jd, double state[6]) const {
+  if (!IsInRange(jd) || body_id < 0 || body_id >= num_of_body_) return false;
+
+  const double elapsed_day = jd - start_jd_;
+  int seg = (int)floor(elapsed_day / segment_length_day_);
+  if (seg >= num_of_segment_) seg = num_of_segment_ - 1;
+  const double tau = 2.0 * (elapsed_day - seg * segment_length_day_) / segment_length_day_ - 1.0;
+
+  // Clenshaw recurrence
+  const int num_of_node = degree_ + 1;
+  const double* coeff = &coefficients_[((size_t)seg * num_of_body_ + body_id) * 6 * num_of_node];
+  for (int c = 0; c < 6; c++) {
+    const double* coeff_c = &coeff[c * num_of_node];
+    double b1 = 0.0;
+    double b2 = 0.0;
+    for (int k = degree_; k >= 1; k--) {
+      const double b0 = 2.0 * tau * b1 - b2 + coeff_c[k];
+      b2 = b1;
+      b1 = b0;
+    }
+    state[c] = tau * b1 - b2 + coeff_c[0];
+  }
+  return true;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file ChebyshevEphemeris.h
+ * @brief Piecewise Chebyshev polynomial approximation of the ephemerides of celestial bodies
+ */
+
+#ifndef __CHEBYSHEV_EPHEMERIS_H__
+#define __CHEBYSHEV_EPHEMERIS_H__
+
+#include <functional>
+#include <vector>
+
+/**
+ * @class ChebyshevEphemeris
+ * @brief Piecewise Chebyshev polynomial approximation of the ephemerides of celestial bodies
+ * @note The fitted time span is divided into segments of constant length. In each segment, the six state components of each body
+ *       are approximated by Chebyshev polynomials whose coefficients are calculated from the samples at the Chebyshev nodes.
+ */
+class ChebyshevEphemeris {
+ public:
+  /**
+   * @fn ChebyshevEphemeris
+   * @brief Constructor
+   * @param [in] num_of_body: Number of celestial bodies
+   * @param [in] segment_length_day: Length of a segment [day]
+   * @param [in] degree: Degree of the Chebyshev polynomials
+   */
+  ChebyshevEphemeris(const int num_of_body, const double segment_length_day, const int degree);
+
+  /**
+   * @fn Fit
+   * @brief Fit the polynomials over the time span
+   * @param [in] start_jd: Start of the time span [Julian day]
+   * @param [in] end_jd: End of the time span [Julian day]
+   * @param [in] sample: Function to get the state (position and velocity) of a body at a Julian day
+   */
+  void Fit(const double start_jd, const double end_jd, const std::function<void(const int body_id, const double jd, double state[6])>& sample);
+
+  /**
+   * @fn Evaluate
+   * @brief Calculate the state of a body with the fitted polynomials
+   * @param [in] body_id: ID of the body
+   * @param [in] jd: Julian day
+   * @param [out] state: State (position and velocity) of the body
+   * @return False when the Julian day is out of the fitted time span
+   */
+  bool Evaluate(const int body_id, const double jd, double state[6]) const;
+
+  // Getter
+  /**
+   * @fn IsInRange
+   * @brief Return true when the Julian day is in the fitted time span
+   */
+  inline bool IsInRange(const double jd) const { return num_of_segment_ > 0 && jd >= start_jd_ && jd <= end_jd_; }
+  /**
+   * @fn GetNumSegment
+   * @brief Return number of the fitted segments
+   */
+  inline int GetNumSegment() const { return num_of_segment_; }
+  /**
+   * @fn GetSegmentLengthDay
+   * @brief Return length of a segment [day]
+   */
+  inline double GetSegmentLengthDay() const { return segment_length_day_; }
+
+ private:
+  int num_of_body_;            //!< Number of celestial bodies
+  double segment_length_day_;  //!< Length of a segment [day]
+  int degree_;                 //!< Degree of the Chebyshev polynomials
+  int num_of_segment_ = 0;     //!< Number of the fitted segments
+  double start_jd_ = 0.0;      //!< Start of the fitted time span [Julian day]
+  double end_jd_ = 0.0;        //!< End of the fitted time span [Julian day]
+
+  std::vector<double> coefficients_;  //!< Chebyshev coefficients ordered as [segment][body][state component][degree]
+};
+
+#endif  //__CHEBYSHEV_EPHEMERIS_H__
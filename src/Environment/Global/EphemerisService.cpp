@@ -0,0 +1,170 @@
+/**
+ * @file EphemerisService.cpp
+ * @brief Process-wide read-only service of the celestial body information built from the SPICE kernels
+ */
+
+#include "EphemerisService.h"
+
+#include <SpiceUsr.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+using namespace std;
+
+mutex EphemerisService::spice_mutex_;
+map<string, shared_ptr<const EphemerisService>> EphemerisService::loaded_;
+mutex EphemerisService::loaded_mutex_;
+set<string> EphemerisService::furnished_kernels_;
+
+EphemerisService::EphemerisService(const string inertial_frame, const string aber_cor, const string center_obj, const vector<int>& selected_body)
+    : selected_body_(selected_body), inertial_frame_(inertial_frame), aber_cor_(aber_cor), center_obj_(center_obj) {
+  lock_guard<mutex> lock(spice_mutex_);
+  const int num_of_selected_body = GetNumBody();
+  gravity_constant_m3_s2_.resize(num_of_selected_body);
+  planetographic_radii_m_.resize(num_of_selected_body * 3);
+  mean_radius_m_.resize(num_of_selected_body);
+
+  for (int i = 0; i < num_of_selected_body; i++) {
+    SpiceInt planet_id = selected_body_[i];
+    SpiceInt dim;
+
+    // Acquisition of gravity constant
+    SpiceDouble gravity_constant;
+    bodvcd_c(planet_id, "GM", 1, &dim, &gravity_constant);
+    // Convert unit [km^3/s^2] to [m^3/s^2]
+    gravity_constant_m3_s2_[i] = gravity_constant * 1E+9;
+
+    // Acquisition of radius
+    SpiceDouble radii_km[3];
+    bodvcd_c(planet_id, "RADII", 3, &dim, (SpiceDouble*)radii_km);
+    for (int j = 0; j < 3; j++) {
+      planetographic_radii_m_[i * 3 + j] = radii_km[j] * 1000.0;
+    }
+    mean_radius_m_[i] = pow(planetographic_radii_m_[i * 3] * planetographic_radii_m_[i * 3 + 1] * planetographic_radii_m_[i * 3 + 2], 1.0 / 3.0);
+
+    // Acquisition of body name from id
+    SpiceBoolean found;
+    const int maxlen = 100;
+    char namebuf[maxlen];
+    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
+    string name = namebuf;
+    selected_body_names_.push_back(name);
+    body_name_to_id_[name] = i;
+
+    // Add `BARYCENTER` if needed
+    if (name == "MARS" || name == "JUPITER" || name == "SATURN" || name == "URANUS" || name == "NEPTUNE" || name == "PLUTO") {
+      spice_target_names_.push_back(name + "_BARYCENTER");
+    } else {
+      spice_target_names_.push_back(name);
+    }
+  }
+
+  center_body_id_ = 0;
+  SpiceInt center_id;
+  SpiceBoolean found;
+  bodn2c_c(center_obj_.c_str(), (SpiceInt*)&center_id, (SpiceBoolean*)&found);
+  for (int i = 0; i < num_of_selected_body; i++) {
+    if (selected_body_[i] == center_id) {
+      center_body_id_ = i;
+      break;
+    }
+  }
+  body_name_to_id_[center_obj_] = center_body_id_;
+}
+
+shared_ptr<const EphemerisService> EphemerisService::Load(const string inertial_frame, const string aber_cor, const string center_obj,
+                                                          const vector<int>& selected_body) {
+  string key = inertial_frame + "," + aber_cor + "," + center_obj;
+  for (int id : selected_body) key += "," + to_string(id);
+
+  lock_guard<mutex> lock(loaded_mutex_);
+  auto itr = loaded_.find(key);
+  if (itr != loaded_.end()) return itr->second;
+
+  auto service = make_shared<const EphemerisService>(inertial_frame, aber_cor, center_obj, selected_body);
+  loaded_[key] = service;
+  return service;
+}
+
+void EphemerisService::FurnishKernel(const string file_name) {
+  lock_guard<mutex> lock(spice_mutex_);
+  if (!furnished_kernels_.insert(file_name).second) return;
+  furnsh_c(file_name.c_str());
+}
+
+bool EphemerisService::FindSpiceId(const char* body_name, int& spice_id) {
+  lock_guard<mutex> lock(spice_mutex_);
+  SpiceInt planet_id;
+  SpiceBoolean found;
+  bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  spice_id = planet_id;
+  return found == SPICETRUE;
+}
+
+int EphemerisService::FindBodyId(const string& body_name) const {
+  auto itr = body_name_to_id_.find(body_name);
+  if (itr == body_name_to_id_.end()) return -1;
+  return itr->second;
+}
+
+shared_ptr<const ChebyshevEphemeris> EphemerisService::GetChebyshevEphemeris(const double start_jd, const double end_jd, const double segment_length_day,
+                                                                             const int degree) const {
+  lock_guard<mutex> chebyshev_lock(chebyshev_mutex_);
+  const auto key = make_tuple(start_jd, end_jd, segment_length_day, degree);
+  auto itr = chebyshev_ephemerides_.find(key);
+  if (itr != chebyshev_ephemerides_.end()) return itr->second;
+
+  lock_guard<mutex> spice_lock(spice_mutex_);
+  const int num_of_selected_body = GetNumBody();
+  auto sample = [this](const int body_id, const double jd, double state[6]) { GetPlanetOrbit(body_id, ConvJdToEt(jd), state); };
+  auto ephemeris = make_shared<ChebyshevEphemeris>(num_of_selected_body, segment_length_day, degree);
+  ephemeris->Fit(start_jd, end_jd, sample);
+
+  // Verification with SPICE at the segment boundaries and the quarter points, which are between the sampling nodes
+  vector<double> max_pos_error_m(num_of_selected_body, 0.0);
+  for (int seg = 0; seg < ephemeris->GetNumSegment(); seg++) {
+    for (int p = 0; p < 2; p++) {
+      const double jd = start_jd + (seg + 0.25 * p) * segment_length_day;
+      for (int i = 0; i < num_of_selected_body; i++) {
+        double state_spice[6], state_chebyshev[6];
+        sample(i, jd, state_spice);
+        ephemeris->Evaluate(i, jd, state_chebyshev);
+        double error_km2 = 0.0;
+        for (int j = 0; j < 3; j++) error_km2 += pow(state_spice[j] - state_chebyshev[j], 2.0);
+        max_pos_error_m[i] = max(max_pos_error_m[i], sqrt(error_km2) * 1000.0);
+      }
+    }
+  }
+  cout << "Chebyshev ephemeris: " << ephemeris->GetNumSegment() << " segments, max position error [m] ";
+  for (int i = 0; i < num_of_selected_body; i++) cout << selected_body_names_[i] << ":" << max_pos_error_m[i] << " ";
+  cout << "\n";
+
+  chebyshev_ephemerides_[key] = ephemeris;
+  return ephemeris;
+}
+
+void EphemerisService::GetStatesFromSpice(const double jd, double* states) const {
+  lock_guard<mutex> lock(spice_mutex_);
+  const double et = ConvJdToEt(jd);
+  for (int i = 0; i < GetNumBody(); i++) GetPlanetOrbit(i, et, &states[i * 6]);
+}
+
+double EphemerisService::ConvJdToEt(const double jd) {
+  // Enough digits to keep the sub-millisecond resolution of the Julian day
+  char jd_str[64];
+  snprintf(jd_str, sizeof(jd_str), "jd %.9f", jd);
+  SpiceDouble et;
+  str2et_c(jd_str, &et);
+  return et;
+}
+
+void EphemerisService::GetPlanetOrbit(const int id, const double et, double orbit[6]) const {
+  // Get orbit
+  SpiceDouble lt;
+  spkezr_c((ConstSpiceChar*)spice_target_names_[id].c_str(), (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_.c_str(),
+           (ConstSpiceChar*)aber_cor_.c_str(), (ConstSpiceChar*)center_obj_.c_str(), (SpiceDouble*)orbit, (SpiceDouble*)&lt);
+  return;
+}
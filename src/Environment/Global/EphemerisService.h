@@ -0,0 +1,188 @@
+/**
+ * @file EphemerisService.h
+ * @brief Process-wide read-only service of the celestial body information built from the SPICE kernels
+ */
+
+#ifndef __EPHEMERIS_SERVICE_H__
+#define __EPHEMERIS_SERVICE_H__
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "ChebyshevEphemeris.h"
+
+/**
+ * @class EphemerisService
+ * @brief Process-wide read-only service of the celestial body information built from the SPICE kernels
+ * @note CSPICE keeps global state and is not thread-safe. All SPICE calls in the simulator go through this class and are
+ *       serialized with a process-wide mutex. The body constants and the fitted Chebyshev ephemerides are immutable after
+ *       construction, so they are shared by all GlobalEnvironment instances and read without locking from any thread.
+ */
+class EphemerisService {
+ public:
+  /**
+   * @fn EphemerisService
+   * @brief Constructor. Use Load to share the instance in the process.
+   * @param [in] inertial_frame: Definition of inertial frame
+   * @param [in] aber_cor: Stellar aberration correction
+   * @param [in] center_obj: Center object of inertial frame
+   * @param [in] selected_body: SPICE IDs of selected bodies
+   */
+  EphemerisService(const std::string inertial_frame, const std::string aber_cor, const std::string center_obj, const std::vector<int>& selected_body);
+
+  /**
+   * @fn Load
+   * @brief Return the service for the setting
+   * @note The service is made only once per process for each setting and shared between all callers
+   * @param [in] inertial_frame: Definition of inertial frame
+   * @param [in] aber_cor: Stellar aberration correction
+   * @param [in] center_obj: Center object of inertial frame
+   * @param [in] selected_body: SPICE IDs of selected bodies
+   */
+  static std::shared_ptr<const EphemerisService> Load(const std::string inertial_frame, const std::string aber_cor, const std::string center_obj,
+                                                      const std::vector<int>& selected_body);
+  /**
+   * @fn FurnishKernel
+   * @brief Load a SPICE kernel file. Each file is loaded only once per process.
+   * @param [in] file_name: Path to the kernel file
+   */
+  static void FurnishKernel(const std::string file_name);
+  /**
+   * @fn FindSpiceId
+   * @brief Convert the body name to the SPICE ID
+   * @param [in] body_name: Name of the body defined in the SPICE
+   * @param [out] spice_id: SPICE ID of the body
+   * @return False when the body is not found
+   */
+  static bool FindSpiceId(const char* body_name, int& spice_id);
+
+  /**
+   * @fn GetChebyshevEphemeris
+   * @brief Return the Chebyshev ephemerides fitted over the time span
+   * @note The ephemerides are fitted with SPICE only once for each setting and shared between all callers.
+   *       The fitted polynomials are verified with SPICE at the points between the sampling nodes.
+   * @param [in] start_jd: Start of the time span [Julian day]
+   * @param [in] end_jd: End of the time span [Julian day]
+   * @param [in] segment_length_day: Length of a segment [day]
+   * @param [in] degree: Degree of the Chebyshev polynomials
+   */
+  std::shared_ptr<const ChebyshevEphemeris> GetChebyshevEphemeris(const double start_jd, const double end_jd, const double segment_length_day,
+                                                                   const int degree) const;
+  /**
+   * @fn GetStatesFromSpice
+   * @brief Get position and velocity of all selected bodies from the center body with SPICE
+   * @note This function locks the SPICE mutex. Use the Chebyshev ephemerides in the periodic calculation of parallel cases.
+   * @param [in] jd: Julian day
+   * @param [out] states: Position [km] and velocity [km/s] in the inertial frame ordered as [body][6]
+   */
+  void GetStatesFromSpice(const double jd, double* states) const;
+
+  // Getter
+  /**
+   * @fn GetNumBody
+   * @brief Return number of selected body
+   */
+  inline int GetNumBody() const { return (int)selected_body_.size(); }
+  /**
+   * @fn GetSelectedBody
+   * @brief Return SPICE IDs of selected bodies
+   */
+  inline const int* GetSelectedBody() const { return selected_body_.data(); }
+  /**
+   * @fn GetInertialFrame
+   * @brief Return definition of inertial frame
+   */
+  inline const std::string& GetInertialFrame() const { return inertial_frame_; }
+  /**
+   * @fn GetCenterBodyName
+   * @brief Return name of the center body
+   */
+  inline const std::string& GetCenterBodyName() const { return center_obj_; }
+  /**
+   * @fn GetCenterBodyId
+   * @brief Return ID of the center body in the CelestialInformation list
+   */
+  inline int GetCenterBodyId() const { return center_body_id_; }
+  /**
+   * @fn GetBodyName
+   * @brief Return name of the body defined in the SPICE
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline const std::string& GetBodyName(const int id) const { return selected_body_names_[id]; }
+  /**
+   * @fn GetGravityConstant
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline double GetGravityConstant(const int id) const { return gravity_constant_m3_s2_[id]; }
+  /**
+   * @fn GetPlanetographicRadii
+   * @brief Return head pointer of the 3 axis planetographic radii of the celestial body [m]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline const double* GetPlanetographicRadii(const int id) const { return &planetographic_radii_m_[id * 3]; }
+  /**
+   * @fn GetMeanRadius
+   * @brief Return mean radius of the celestial body [m]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline double GetMeanRadius(const int id) const { return mean_radius_m_[id]; }
+  /**
+   * @fn FindBodyId
+   * @brief Return ID of CelestialInformation list from the body name in the name table
+   * @param [in] body_name: Name of the body defined in the SPICE
+   * @return ID of CelestialInformation list. -1 when the name is not in the table.
+   */
+  int FindBodyId(const std::string& body_name) const;
+
+ private:
+  // Setting parameters
+  std::vector<int> selected_body_;  //!< SPICE IDs of selected bodies
+  std::string inertial_frame_;      //!< Definition of inertial frame
+  std::string aber_cor_;            //!< Stellar aberration correction
+  std::string center_obj_;          //!< Center object of inertial frame
+
+  // Body name table
+  std::vector<std::string> selected_body_names_;  //!< Names of selected bodies defined in the SPICE
+  std::vector<std::string> spice_target_names_;   //!< Target names of selected bodies used in spkezr_c
+  std::map<std::string, int> body_name_to_id_;    //!< Table from the body name to the ID of CelestialInformation list
+  int center_body_id_;                            //!< ID of the center body in the CelestialInformation list
+
+  // Body constants
+  std::vector<double> gravity_constant_m3_s2_;  //!< Gravity constant list [m^3/s^2]
+  std::vector<double> planetographic_radii_m_;  //!< 3 axis planetographic radii list [m]
+  std::vector<double> mean_radius_m_;           //!< Mean radius list [m] r = (rx * ry * rz)^(1/3)
+
+  // Fitted Chebyshev ephemerides for each (start_jd, end_jd, segment_length_day, degree)
+  mutable std::map<std::tuple<double, double, double, int>, std::shared_ptr<const ChebyshevEphemeris>> chebyshev_ephemerides_;
+  mutable std::mutex chebyshev_mutex_;  //!< Mutex for chebyshev_ephemerides_
+
+  static std::mutex spice_mutex_;                                                 //!< Mutex to serialize all SPICE calls
+  static std::map<std::string, std::shared_ptr<const EphemerisService>> loaded_;  //!< Loaded services
+  static std::mutex loaded_mutex_;                                                //!< Mutex for loaded_
+  static std::set<std::string> furnished_kernels_;                                //!< Loaded SPICE kernel files
+
+  /**
+   * @fn ConvJdToEt
+   * @brief Convert Julian day to the ephemeris time used in SPICE. The SPICE mutex must be locked.
+   * @param [in] jd: Julian day
+   * @return Ephemeris time [sec]
+   */
+  static double ConvJdToEt(const double jd);
+  /**
+   * @fn GetPlanetOrbit
+   * @brief Get position/velocity of planet. The SPICE mutex must be locked.
+   * @note This is an override function of SPICE's spkezr_c (https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkezr_c.html)
+   * @param [in] id: ID of CelestialInformation list
+   * @param [in] et: Ephemeris time [sec]
+   * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
+   */
+  void GetPlanetOrbit(const int id, const double et, double orbit[6]) const;
+};
+
+#endif  //__EPHEMERIS_SERVICE_H__
@@ -17,6 +17,7 @@ GlobalEnvironment::~GlobalEnvironment() {
   delete celes_info_;
   delete hipp_;
   delete gnss_satellites_;
+  delete atmosphere_service_;
 }
 
 void GlobalEnvironment::Initialize(SimulationConfig* sim_config) {
@@ -29,8 +30,11 @@ void GlobalEnvironment::Initialize(SimulationConfig* sim_config) {
   celes_info_ = InitCelesInfo(sim_config->ini_base_fname_);
   hipp_ = InitHipCatalogue(sim_config->ini_base_fname_);
   gnss_satellites_ = InitGnssSatellites(sim_config->gnss_file_);
+  atmosphere_service_ = InitAtmosphereService(sim_config->ini_base_fname_, sim_time_->GetCurrentDecyear(), sim_time_->GetEndSec());
 
   // Calc initial value
+  const double start_jd = sim_time_->GetCurrentJd();
+  celes_info_->PrecomputeEphemeris(start_jd, start_jd + sim_time_->GetEndSec() / (24.0 * 60.0 * 60.0));
   celes_info_->UpdateAllObjectsInfo(sim_time_->GetCurrentJd());
   gnss_satellites_->SetUp(sim_time_);
 }
@@ -43,7 +47,7 @@ void GlobalEnvironment::Update() {
 
 void GlobalEnvironment::LogSetup(Logger& logger) {
   logger.AddLoggable(sim_time_);
-  logger.AddLoggable(celes_info_);
+  logger.AddLoggable(celes_info_, "celestial");
 }
 
 void GlobalEnvironment::Reset(void) { sim_time_->ResetClock(); }
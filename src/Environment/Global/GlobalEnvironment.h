@@ -8,6 +8,7 @@
 #include <Interface/LogOutput/Logger.h>
 #include <Simulation/SimulationConfig.h>
 
+#include "AtmosphereService.h"
 #include "CelestialInformation.h"
 #include "GnssSatellites.h"
 #include "HipparcosCatalogue.h"
@@ -74,10 +75,21 @@ class GlobalEnvironment {
    * @brief Return GnssSatellites
    */
   inline const GnssSatellites& GetGnssSatellites() const { return *gnss_satellites_; }
+  /**
+   * @fn GetAtmosphereService
+   * @brief Return AtmosphereService
+   */
+  inline const AtmosphereService& GetAtmosphereService() const { return *atmosphere_service_; }
+  /**
+   * @fn GetAtmosphereService
+   * @brief Return AtmosphereService to calculate the densities of all spacecraft in a step with UpdateDensities
+   */
+  inline AtmosphereService& GetAtmosphereService() { return *atmosphere_service_; }
 
  private:
-  SimTime* sim_time_;                 //!< Simulation time
-  CelestialInformation* celes_info_;  //!< Celestial bodies information
-  HipparcosCatalogue* hipp_;          //!< Hipparcos catalogue
-  GnssSatellites* gnss_satellites_;   //!< GNSS satellites
+  SimTime* sim_time_;                      //!< Simulation time
+  CelestialInformation* celes_info_;       //!< Celestial bodies information
+  HipparcosCatalogue* hipp_;               //!< Hipparcos catalogue
+  GnssSatellites* gnss_satellites_;        //!< GNSS satellites
+  AtmosphereService* atmosphere_service_;  //!< Atmospheric density service shared by all spacecraft
 };
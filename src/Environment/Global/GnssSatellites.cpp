@@ -1077,16 +1077,12 @@ double GnssSatellites::AddIonosphericDelay(const int sat_id, const libra::Vector
   return delay;
 }
 
-std::string GnssSatellites::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  return str_tmp;
+void GnssSatellites::GetLogSchema(LogSchema& schema) const {
+  UNUSED(schema);
 }
 
-std::string GnssSatellites::GetLogValue() const {
-  std::string str_tmp = "";
-
-  return str_tmp;
+void GnssSatellites::LogValues(LogSink& sink) const {
+  UNUSED(sink);
 }
 
 void GnssSatellites::DebugOutput() {
@@ -5,6 +5,7 @@
 #include "HipparcosCatalogue.h"
 
 #include <Library/math/Constant.hpp>
+#include <Library/utils/Macros.hpp>
 #include <algorithm>
 #include <fstream>
 #include <iostream>
@@ -14,19 +15,33 @@
 
 using namespace std;
 
+map<pair<string, double>, shared_ptr<const vector<HipData>>> HipparcosCatalogue::loaded_;
+mutex HipparcosCatalogue::loaded_mutex_;
+
 HipparcosCatalogue::HipparcosCatalogue(double max_magnitude, string catalogue_path)
-    : max_magnitude_(max_magnitude), catalogue_path_(catalogue_path) {}
+    : hip_catalogue(make_shared<const vector<HipData>>()), max_magnitude_(max_magnitude), catalogue_path_(catalogue_path) {}
 
 HipparcosCatalogue::~HipparcosCatalogue() {}
 
 bool HipparcosCatalogue::ReadContents(const string& filename, const char delimiter = ',') {
   if (!IsCalcEnabled) return false;
 
+  const auto key = make_pair(filename + delimiter, max_magnitude_);
+  lock_guard<mutex> lock(loaded_mutex_);
+  auto itr = loaded_.find(key);
+  if (itr != loaded_.end()) {
+    hip_catalogue = itr->second;
+    return true;
+  }
+
   ifstream ifs(filename);
   if (!ifs.is_open()) {
     cerr << "file open error(hip_main.csv)";
     return false;
   }
+  auto catalogue = make_shared<vector<HipData>>();
+  hip_catalogue = catalogue;
+  loaded_[key] = catalogue;
 
   string title;
   ifs >> title;  // Skip title
@@ -43,7 +58,7 @@ bool HipparcosCatalogue::ReadContents(const string& filename, const char delimit
     if (hipdata.vmag > max_magnitude_) {
       return true;
     }  // Don't read stars darker than max_magnitude
-    hip_catalogue.push_back(hipdata);
+    catalogue->push_back(hipdata);
   }
 
   return true;
@@ -71,14 +86,10 @@ libra::Vector<3> HipparcosCatalogue::GetStarDir_b(int rank, Quaternion q_i2b) co
   return position_b;
 }
 
-string HipparcosCatalogue::GetLogHeader() const {
-  string str_tmp = "";
-
-  return str_tmp;
+void HipparcosCatalogue::GetLogSchema(LogSchema& schema) const {
+  UNUSED(schema);
 }
 
-string HipparcosCatalogue::GetLogValue() const {
-  string str_tmp = "";
-
-  return str_tmp;
+void HipparcosCatalogue::LogValues(LogSink& sink) const {
+  UNUSED(sink);
 }
@@ -7,6 +7,10 @@
 
 #include <Library/math/Quaternion.hpp>
 #include <Library/math/Vector.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 /**
@@ -41,6 +45,7 @@ class HipparcosCatalogue : public ILoggable {
   /**
    *@fn ReadContents
    *@brief Read Hipparcos catalogue file
+   *@note The read catalogue is shared in the process for each file and maximum magnitude, and the file is read only once.
    *@param [in] file_name: Path to Hipparcos catalogue file
    *@param [in] delimiter: Delimiter for the catalogue file
    */
@@ -50,31 +55,31 @@ class HipparcosCatalogue : public ILoggable {
    *@fn GetCatalogueSize
    *@brief Return read catalogue size
    */
-  int GetCatalogueSize() const { return hip_catalogue.size(); }
+  int GetCatalogueSize() const { return (int)hip_catalogue->size(); }
   /**
    *@fn GetHipID
    *@brief Return Hipparcos ID of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  int GetHipID(int rank) const { return hip_catalogue[rank].hip_num; }
+  int GetHipID(int rank) const { return (*hip_catalogue)[rank].hip_num; }
   /**
    *@fn GetVmag
    *@brief Return magnitude in visible wave length of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetVmag(int rank) const { return hip_catalogue[rank].vmag; }
+  double GetVmag(int rank) const { return (*hip_catalogue)[rank].vmag; }
   /**
    *@fn GetRA
    *@brief Return right ascension of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetRA(int rank) const { return hip_catalogue[rank].ra; }
+  double GetRA(int rank) const { return (*hip_catalogue)[rank].ra; }
   /**
    *@fn GetDE
    *@brief Return declination of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetDE(int rank) const { return hip_catalogue[rank].de; }
+  double GetDE(int rank) const { return (*hip_catalogue)[rank].de; }
   /**
    *@fn GetStarDir_i
    *@brief Return direction vector of a star in the inertial frame
@@ -91,20 +96,23 @@ class HipparcosCatalogue : public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
   bool IsCalcEnabled = true;  //!< Calculation enable flag
 
  private:
-  std::vector<HipData> hip_catalogue;  //!< Data base of the read Hipparcos catalogue
-  double max_magnitude_;               //!< Maximum magnitude in the data base
-  std::string catalogue_path_;         //!< Path to Hipparcos catalog file
+  std::shared_ptr<const std::vector<HipData>> hip_catalogue;  //!< Data base of the read Hipparcos catalogue
+  double max_magnitude_;                                      //!< Maximum magnitude in the data base
+  std::string catalogue_path_;                                //!< Path to Hipparcos catalog file
+
+  static std::map<std::pair<std::string, double>, std::shared_ptr<const std::vector<HipData>>> loaded_;  //!< Read catalogues
+  static std::mutex loaded_mutex_;                                                                      //!< Mutex for loaded_
 };
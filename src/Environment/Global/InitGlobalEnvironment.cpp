@@ -6,9 +6,10 @@
 
 #include <Environment/Global/SimTime.h>
 #include <Interface/InitInput/IniAccess.h>
-#include <SpiceUsr.h>
+#include <Library/math/Constant.hpp>
 
-#include <cassert>
+#include <cstdlib>
+#include <iostream>
 
 #define CALC_LABEL "calculation"
 #define LOG_LABEL "logging"
@@ -60,6 +61,47 @@ HipparcosCatalogue* InitHipCatalogue(std::string file_name) {
   return hip_catalogue;
 }
 
+AtmosphereService* InitAtmosphereService(std::string file_name, const double start_decyear, const double end_sec) {
+  IniAccess ini_file(file_name);
+  const char* section = "ATMOSPHERE_SERVICE";
+
+  AtmosphereService* atmosphere_service;
+  if (ini_file.ReadEnable(section, CALC_LABEL)) {
+    // The model settings are shared with the atmosphere of the spacecraft
+    IniAccess atmosphere_conf(ini_file.ReadString(section, "atmosphere_file"));
+    const char* atmosphere_section = "ATMOSPHERE";
+    std::string model = atmosphere_conf.ReadString(atmosphere_section, "model");
+    std::string table_path = atmosphere_conf.ReadString(atmosphere_section, "nrlmsise00_table_path");
+    bool is_manual_param_used = atmosphere_conf.ReadEnable(atmosphere_section, "is_manual_param_used");
+    double manual_daily_f107 = atmosphere_conf.ReadDouble(atmosphere_section, "manual_daily_f107");
+    double manual_average_f107 = atmosphere_conf.ReadDouble(atmosphere_section, "manual_average_f107");
+    double manual_ap = atmosphere_conf.ReadDouble(atmosphere_section, "manual_ap");
+    bool is_interpolated = atmosphere_conf.ReadEnable(atmosphere_section, "space_weather_interpolation");
+    atmosphere_service = new AtmosphereService(model, table_path, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap,
+                                               is_interpolated, start_decyear, end_sec);
+    if (atmosphere_conf.ReadEnable(atmosphere_section, "is_density_cache_enabled")) {
+      double update_period_s = atmosphere_conf.ReadDouble(atmosphere_section, "density_cache_update_period_s");
+      double min_altitude_m = atmosphere_conf.ReadDouble(atmosphere_section, "density_cache_min_altitude_km") * 1000.0;
+      double max_altitude_m = atmosphere_conf.ReadDouble(atmosphere_section, "density_cache_max_altitude_km") * 1000.0;
+      double altitude_step_m = atmosphere_conf.ReadDouble(atmosphere_section, "density_cache_altitude_step_km") * 1000.0;
+      double latitude_step_rad = atmosphere_conf.ReadDouble(atmosphere_section, "density_cache_latitude_step_deg") * libra::deg_to_rad;
+      double local_time_step_hour = atmosphere_conf.ReadDouble(atmosphere_section, "density_cache_local_time_step_hour");
+      if (!(altitude_step_m > 0.0) || !(latitude_step_rad > 0.0) || !(local_time_step_hour > 0.0)) {
+        std::cerr << "Steps of the density cache must be positive. Check [ATMOSPHERE] section in the atmosphere_file of [ATMOSPHERE_SERVICE]."
+                  << std::endl;
+        exit(1);
+      }
+      atmosphere_service->SetDensityGrid(update_period_s, min_altitude_m, max_altitude_m, altitude_step_m, latitude_step_rad,
+                                         local_time_step_hour);
+    }
+  } else {
+    atmosphere_service = new AtmosphereService("NONE", "", true, 0.0, 0.0, 0.0, false, start_decyear, end_sec);
+    atmosphere_service->IsCalcEnabled = false;
+  }
+
+  return atmosphere_service;
+}
+
 CelestialInformation* InitCelesInfo(std::string file_name) {
   IniAccess ini_file(file_name);
   const char* section = "PLANET_SELECTION";
@@ -74,23 +116,23 @@ CelestialInformation* InitCelesInfo(std::string file_name) {
   std::vector<std::string> keywords = {"TLS", "TPC1", "TPC2", "TPC3", "BSP"};
   for (size_t i = 0; i < keywords.size(); i++) {
     std::string fname = ini_file.ReadString(furnsh_section, keywords[i].c_str());
-    furnsh_c(fname.c_str());
+    EphemerisService::FurnishKernel(fname);
   }
 
   // Initialize celestial body list
   const int num_of_selected_body = ini_file.ReadInt(section, "num_of_selected_body");
-  int* selected_body = new int[num_of_selected_body];
+  std::vector<int> selected_body(num_of_selected_body);
   for (int i = 0; i < num_of_selected_body; i++) {
     // Convert body name to SPICE ID
     std::string selected_body_i = "selected_body(" + std::to_string(i) + ")";
     char selected_body_temp[30];
     ini_file.ReadChar(section, selected_body_i.c_str(), 30, selected_body_temp);
-    SpiceInt planet_id;
-    SpiceBoolean found;
-    bodn2c_c(selected_body_temp, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
-
+    int planet_id;
     // If the object specified in the ini file is not found, exit the program.
-    assert(found == SPICETRUE);
+    if (!EphemerisService::FindSpiceId(selected_body_temp, planet_id)) {
+      std::cerr << "Selected body " << selected_body_temp << " is not found in the SPICE kernels." << std::endl;
+      exit(1);
+    }
 
     selected_body[i] = planet_id;
   }
@@ -110,7 +152,21 @@ CelestialInformation* InitCelesInfo(std::string file_name) {
   }
 
   CelestialInformation* celestial_info;
-  celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, rotation_mode, num_of_selected_body, selected_body);
+  // The ephemeris service is shared with the other cases which use the same setting
+  auto ephemeris_service = EphemerisService::Load(inertial_frame, aber_cor, center_obj, selected_body);
+  celestial_info = new CelestialInformation(ephemeris_service, rotation_mode);
+
+  // Update interval of the precession and nutation in the Full rotation mode
+  celestial_info->SetEarthPrecessionNutationUpdateInterval(ini_file.ReadDouble(section, "precession_nutation_update_interval_sec"));
+
+  // Read ephemeris setting
+  // The Chebyshev ephemerides are fitted in GlobalEnvironment after the simulation time span is determined
+  std::string ephemeris_method = ini_file.ReadString(section, "ephemeris_method");
+  if (ephemeris_method == "CHEBYSHEV") {
+    const double segment_length_day = ini_file.ReadDouble(section, "chebyshev_segment_length_day");
+    const int degree = ini_file.ReadInt(section, "chebyshev_degree");
+    celestial_info->SetEphemerisMethod(EphemerisMethod::Chebyshev, segment_length_day, degree);
+  }
 
   // log setting
   celestial_info->IsLogEnabled = ini_file.ReadEnable(section, LOG_LABEL);
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <Environment/Global/AtmosphereService.h>
 #include <Environment/Global/CelestialInformation.h>
 #include <Environment/Global/HipparcosCatalogue.h>
 #include <Environment/Global/SimTime.h>
@@ -23,6 +24,15 @@ SimTime* InitSimTime(std::string file_name);
  */
 HipparcosCatalogue* InitHipCatalogue(std::string file_name);
 
+/**
+ *@fn InitAtmosphereService
+ *@brief Initialize function for AtmosphereService class
+ *@param [in] file_name: Path to the initialize function
+ *@param [in] start_decyear: Decimal year of the simulation start [year]
+ *@param [in] end_sec: End time of simulation [sec]
+ */
+AtmosphereService* InitAtmosphereService(std::string file_name, const double start_decyear, const double end_sec);
+
 /**
  *@fn InitCelesInfo
  *@brief Initialize function for CelestialInformation class
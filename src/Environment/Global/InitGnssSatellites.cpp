@@ -8,6 +8,8 @@
 #include <Interface/InitInput/IniAccess.h>
 
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
 
 std::string return_dirctory_path(std::string sort) {
@@ -47,8 +49,18 @@ std::string return_dirctory_path(std::string sort) {
   return main_directory + sub_directory;
 }
 
+// The raw contents are kept in the process so that each file is read only once
+static std::map<std::string, std::vector<std::string>> loaded_raw_contents;
+static std::mutex loaded_raw_contents_mutex;
+
 void get_raw_contents(std::string directory_path, std::string file_name, std::vector<std::string>& storage) {
   std::string all_file_path = directory_path + file_name;
+  std::lock_guard<std::mutex> lock(loaded_raw_contents_mutex);
+  auto itr = loaded_raw_contents.find(all_file_path);
+  if (itr != loaded_raw_contents.end()) {
+    storage = itr->second;
+    return;
+  }
   std::ifstream ifs(all_file_path);
 
   if (!ifs.is_open()) {
@@ -61,6 +73,7 @@ void get_raw_contents(std::string directory_path, std::string file_name, std::ve
   }
   ifs.close();
   if (storage.back() == "EOF") storage.pop_back();
+  loaded_raw_contents[all_file_path] = storage;
 
   return;
 }
@@ -6,7 +6,9 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include "SimTime.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #ifdef WIN32
@@ -33,16 +35,20 @@ SimTime::SimTime(const double end_sec, const double step_sec, const double attit
   compo_update_interval_sec_ = compo_propagate_step_sec;
   compo_propagate_frequency_ = int(1.0 / compo_update_interval_sec_);
   sim_speed_ = sim_speed;
-  disp_period_ = (1.0 * end_sec / step_sec / 100);  // Update every 1%
   time_exceeds_continuously_limit_sec_ = 1.0;
 
+  end_ticks_ = SecToTicks(end_sec_);
+  step_ticks_ = max<int64_t>(SecToTicks(step_sec_), 1);
+  attitude_update_period_ = CalcUpdatePeriod(attitude_update_interval_sec_);
+  orbit_update_period_ = CalcUpdatePeriod(orbit_update_interval_sec_);
+  thermal_update_period_ = CalcUpdatePeriod(thermal_update_interval_sec_);
+  compo_update_period_ = CalcUpdatePeriod(compo_update_interval_sec_);
+  log_output_period_ = CalcUpdatePeriod(log_output_interval_sec_);
+  disp_period_ = max<int64_t>(end_ticks_ / step_ticks_ / 100, 1);  // Update every 1%
+
   //  sscanf_s(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_mon_, &start_day_, &start_hr_, &start_min_, &start_sec_);
   sscanf(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_mon_, &start_day_, &start_hr_, &start_min_, &start_sec_);
   jday(start_year_, start_mon_, start_day_, start_hr_, start_min_, start_sec_, start_jd_);
-  current_jd_ = start_jd_;
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalndarDay(current_jd_);
   AssertTimeStepParams();
   InitializeState();
   SetParameters();
@@ -64,8 +70,19 @@ void SimTime::AssertTimeStepParams() {
   assert(step_sec_ <= log_output_interval_sec_);
 }
 
+int64_t SimTime::SecToTicks(const double sec) { return llround(sec * kTicksPerSec); }
+
+int64_t SimTime::CalcUpdatePeriod(const double interval_sec) const {
+  const int64_t interval_ticks = SecToTicks(interval_sec);
+  return max<int64_t>((interval_ticks + step_ticks_ - 1) / step_ticks_, 1);
+}
+
 void SimTime::SetParameters(void) {
+  elapsed_ticks_ = 0;
   elapsed_time_sec_ = 0.0;
+  sidereal_ticks_ = -1;
+  decyear_ticks_ = -1;
+  utc_ticks_ = -1;
   attitude_update_counter_ = 1;
   attitude_update_flag_ = false;
   orbit_update_counter_ = 1;
@@ -81,7 +98,8 @@ void SimTime::SetParameters(void) {
 
 void SimTime::UpdateTime(void) {
   InitializeState();
-  elapsed_time_sec_ += step_sec_;
+  elapsed_ticks_ += step_ticks_;
+  elapsed_time_sec_ = (double)elapsed_ticks_ / kTicksPerSec;
   if (sim_speed_ > 0) {
     chrono::system_clock clk;
     int toWaitTime =
@@ -96,8 +114,9 @@ void SimTime::UpdateTime(void) {
         cout << "Error: the specified step_sec is too small for this computer.\r\n";
 
         // Forcibly set elapsed_tim_sec_ as actual elapsed time Reason: to catch up with real time when resume from a breakpoint
-        elapsed_time_sec_ =
-            (chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() * sim_speed_);
+        elapsed_ticks_ = SecToTicks(chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() *
+                                    sim_speed_);
+        elapsed_time_sec_ = (double)elapsed_ticks_ / kTicksPerSec;
 
         clock_last_time_completed_step_in_time_ = clk.now();
       }
@@ -120,52 +139,71 @@ void SimTime::UpdateTime(void) {
   log_counter_++;
   disp_counter_++;
 
-  if (elapsed_time_sec_ > end_sec_) {
+  if (elapsed_ticks_ > end_ticks_) {
     state_.finish = true;
   }
 
-  current_jd_ = start_jd_ + elapsed_time_sec_ / (60.0 * 60.0 * 24.0);
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalndarDay(current_jd_);
-
   attitude_update_flag_ = false;
-  if (double(attitude_update_counter_) * step_sec_ >= attitude_update_interval_sec_) {
+  if (attitude_update_counter_ >= attitude_update_period_) {
     attitude_update_counter_ = 0;
     attitude_update_flag_ = true;
   }
 
   orbit_update_flag_ = false;
-  if (double(orbit_update_counter_) * step_sec_ >= orbit_update_interval_sec_) {
+  if (orbit_update_counter_ >= orbit_update_period_) {
     orbit_update_counter_ = 0;
     orbit_update_flag_ = true;
   }
 
   thermal_update_flag_ = false;
-  if (double(thermal_update_counter_) * step_sec_ >= thermal_update_interval_sec_) {
+  if (thermal_update_counter_ >= thermal_update_period_) {
     thermal_update_counter_ = 0;
     thermal_update_flag_ = true;
   }
 
   compo_update_flag_ = false;
-  if (double(compo_update_counter_) * step_sec_ >= compo_update_interval_sec_) {
+  if (compo_update_counter_ >= compo_update_period_) {
     compo_update_counter_ = 0;
     compo_update_flag_ = true;
   }
 
-  if (double(log_counter_) * step_sec_ >= log_output_interval_sec_) {
+  if (log_counter_ >= log_output_period_) {
     log_counter_ = 0;
     state_.log_output = true;
   }
 
   if (disp_counter_ >= disp_period_) {
-    disp_counter_ -= (int)disp_period_;
+    disp_counter_ -= disp_period_;
     state_.disp_output = true;
   }
 
   state_.running = true;
 }
 
+double SimTime::GetCurrentSidereal(void) const {
+  if (sidereal_ticks_ != elapsed_ticks_) {
+    current_sidereal_ = gstime(GetCurrentJd());
+    sidereal_ticks_ = elapsed_ticks_;
+  }
+  return current_sidereal_;
+}
+
+double SimTime::GetCurrentDecyear(void) const {
+  if (decyear_ticks_ != elapsed_ticks_) {
+    JdToDecyear(GetCurrentJd(), &current_decyear_);
+    decyear_ticks_ = elapsed_ticks_;
+  }
+  return current_decyear_;
+}
+
+const UTC SimTime::GetCurrentUTC(void) const {
+  if (utc_ticks_ != elapsed_ticks_) {
+    ConvJDtoCalndarDay(GetCurrentJd());
+    utc_ticks_ = elapsed_ticks_;
+  }
+  return current_utc_;
+}
+
 void SimTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
 
 void SimTime::PrintStartDateTime(void) const {
@@ -190,21 +228,9 @@ void SimTime::PrintStartDateTime(void) const {
   cout << " " << start_year_ << "/" << start_mon_ << "/" << start_day_ << " " << h.str() << ":" << m.str() << ":" << s.str() << "\n";
 }
 
-string SimTime::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteScalar("time", "sec");
-
-  return str_tmp;
-}
-
-string SimTime::GetLogValue() const {
-  string str_tmp = "";
+void SimTime::GetLogSchema(LogSchema& schema) const { schema.AddScalar("time", "sec"); }
 
-  str_tmp += WriteScalar(elapsed_time_sec_);
-
-  return str_tmp;
-}
+void SimTime::LogValues(LogSink& sink) const { sink.Add(elapsed_time_sec_); }
 
 void SimTime::InitializeState() {
   state_.disp_output = false;
@@ -214,7 +240,7 @@ void SimTime::InitializeState() {
 }
 
 // wrapper function of invjday @ sgp4ext for interface adjustment
-void SimTime::ConvJDtoCalndarDay(const double JD) {
+void SimTime::ConvJDtoCalndarDay(const double JD) const {
   int year, mon, day, hr, min;
   double sec;
   invjday(JD, year, mon, day, hr, min, sec);
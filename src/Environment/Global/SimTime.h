@@ -18,6 +18,7 @@
 #include <Library/sgp4/sgp4unit.h>
 
 #include <chrono>
+#include <cstdint>
 
 /**
  *@struct TimeState
@@ -46,6 +47,11 @@ struct UTC {
 /**
  *@class SimTime
  *@brief Class to manage simulation time related information
+ *@note The time is counted with integer ticks of nanosecond, and the update intervals are integer multiples of the simulation step.
+ *      Therefore the elapsed time and the update timings do not drift in long simulations.
+ *      The sidereal time, the decimal year and the UTC calendar are calculated only when they are requested.
+ *      The const getters of them fill the caches without synchronization, so an instance must not be shared between threads.
+ *      Each Monte-Carlo case owns its own SimTime.
  */
 class SimTime : public ILoggable {
  public:
@@ -102,6 +108,16 @@ class SimTime : public ILoggable {
    *@brief Return simulation elapsed time [sec]
    */
   inline double GetElapsedSec(void) const { return elapsed_time_sec_; };
+  /**
+   *@fn GetElapsedTicks
+   *@brief Return simulation elapsed time [tick]
+   */
+  inline int64_t GetElapsedTicks(void) const { return elapsed_ticks_; };
+  /**
+   *@fn GetTicksPerSec
+   *@brief Return number of ticks in a second
+   */
+  static inline int64_t GetTicksPerSec(void) { return kTicksPerSec; };
   /**
    *@fn GetStepSec
    *@brief Return simulation step [sec]
@@ -186,22 +202,25 @@ class SimTime : public ILoggable {
    *@fn GetCurrentJd
    *@brief Return current Julian day [day]
    */
-  inline double GetCurrentJd(void) const { return current_jd_; };
+  inline double GetCurrentJd(void) const { return start_jd_ + elapsed_time_sec_ / (60.0 * 60.0 * 24.0); };
   /**
    *@fn GetCurrentSidereal
    *@brief Return current sidereal day [day]
+   *@note Calculated at the first request in each step
    */
-  inline double GetCurrentSidereal(void) const { return current_sidereal_; };
+  double GetCurrentSidereal(void) const;
   /**
    *@fn GetCurrentDecyear
    *@brief Return current decimal year [year]
+   *@note Calculated at the first request in each step
    */
-  inline double GetCurrentDecyear(void) const { return current_decyear_; };
+  double GetCurrentDecyear(void) const;
   /**
    *@fn GetCurrentUTC
    *@brief Return current UTC calendar expression
+   *@note Calculated at the first request in each step
    */
-  inline const UTC GetCurrentUTC(void) const { return current_utc_; };
+  const UTC GetCurrentUTC(void) const;
 
   /**
    *@fn GetStartYear
@@ -236,15 +255,15 @@ class SimTime : public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
   /**
    * @fn PrintStartDateTime
@@ -253,25 +272,32 @@ class SimTime : public ILoggable {
   void PrintStartDateTime(void) const;
 
  private:
+  static const int64_t kTicksPerSec = 1000000000;  //!< Number of ticks in a second
+
   // Variables
+  int64_t elapsed_ticks_;    //!< Elapsed time from start of simulation [tick]
   double elapsed_time_sec_;  //!< Elapsed time from start of simulation [sec]
-  double current_jd_;        //!< Current Julian date [day]
-  double current_sidereal_;  //!< Current Greenwich sidereal time (GST) [day]
-  double current_decyear_;   //!< Current decimal year [year]
-  UTC current_utc_;          //!< UTC calendar day
+
+  // Calendar and sidereal time calculated at the first request in each step. Not thread-safe.
+  mutable int64_t sidereal_ticks_;   //!< Elapsed time when current_sidereal_ is calculated [tick]
+  mutable double current_sidereal_;  //!< Current Greenwich sidereal time (GST) [day]
+  mutable int64_t decyear_ticks_;    //!< Elapsed time when current_decyear_ is calculated [tick]
+  mutable double current_decyear_;   //!< Current decimal year [year]
+  mutable int64_t utc_ticks_;        //!< Elapsed time when current_utc_ is calculated [tick]
+  mutable UTC current_utc_;          //!< UTC calendar day
 
   // Timing controller
-  int attitude_update_counter_;  //!< Update counter for attitude calculation
-  bool attitude_update_flag_;    //!< Update flag for attitude calculation
-  int orbit_update_counter_;     //!< Update counter for orbit calculation
-  bool orbit_update_flag_;       //!< Update flag for orbit calculation
-  int thermal_update_counter_;   //!< Update counter for thermal calculation
-  bool thermal_update_flag_;     //!< Update flag for thermal calculation
-  int compo_update_counter_;     //!< Update counter for component calculation
-  bool compo_update_flag_;       //!< Update flag for component calculation
-  int log_counter_;              //!< Update counter for log output
-  int disp_counter_;             //!< Update counter for display output
-  TimeState state_;              //!< State of timing controller
+  int64_t attitude_update_counter_;  //!< Update counter for attitude calculation [step]
+  bool attitude_update_flag_;        //!< Update flag for attitude calculation
+  int64_t orbit_update_counter_;     //!< Update counter for orbit calculation [step]
+  bool orbit_update_flag_;           //!< Update flag for orbit calculation
+  int64_t thermal_update_counter_;   //!< Update counter for thermal calculation [step]
+  bool thermal_update_flag_;         //!< Update flag for thermal calculation
+  int64_t compo_update_counter_;     //!< Update counter for component calculation [step]
+  bool compo_update_flag_;           //!< Update flag for component calculation
+  int64_t log_counter_;              //!< Update counter for log output [step]
+  int64_t disp_counter_;             //!< Update counter for display output [step]
+  TimeState state_;                  //!< State of timing controller
 
   // Calculation time measure
   std::chrono::system_clock::time_point clock_start_time_millisec_;  //!< Simulation start time [ms]
@@ -290,7 +316,15 @@ class SimTime : public ILoggable {
   double compo_update_interval_sec_;     //!< Update intercal for component calculation [sec]
   int compo_propagate_frequency_;        //!< Component propagation frequency [Hz]
   double log_output_interval_sec_;       //!< Log output interval [sec]
-  double disp_period_;                   //!< Display output period [sec]
+
+  int64_t end_ticks_;               //!< Time from start of simulation to end [tick]
+  int64_t step_ticks_;              //!< Simulation step width [tick]
+  int64_t attitude_update_period_;  //!< Update period for attitude calculation [step]
+  int64_t orbit_update_period_;     //!< Update period for orbit calculation [step]
+  int64_t thermal_update_period_;   //!< Update period for thermal calculation [step]
+  int64_t compo_update_period_;     //!< Update period for component calculation [step]
+  int64_t log_output_period_;       //!< Log output period [step]
+  int64_t disp_period_;             //!< Display output period [step]
 
   double start_jd_;   //!< Simulation start Julian date [day]
   int start_year_;    //!< Simulation start year
@@ -313,11 +347,25 @@ class SimTime : public ILoggable {
    * @brief Check the timing setting parameters are correct
    */
   void AssertTimeStepParams();
+  /**
+   * @fn SecToTicks
+   * @brief Convert time in second to ticks
+   * @param [in] sec: Time [sec]
+   * @return Time [tick]
+   */
+  static int64_t SecToTicks(const double sec);
+  /**
+   * @fn CalcUpdatePeriod
+   * @brief Calculate the update period as an integer multiple of the simulation step
+   * @param [in] interval_sec: Update interval [sec]
+   * @return Update period [step]. The interval is rounded up to the multiple of the step.
+   */
+  int64_t CalcUpdatePeriod(const double interval_sec) const;
   /**
    * @fn ConvJDtoCalndarDay
    * @brief Convert Julian date to UTC Calendar date
    * @note wrapper function of invjday @ sgp4ext for interface adjustment
    */
-  void ConvJDtoCalndarDay(const double JD);
+  void ConvJDtoCalndarDay(const double JD) const;
 };
 #endif  //__SIMULATION_TIME_H__
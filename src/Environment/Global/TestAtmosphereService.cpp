@@ -0,0 +1,90 @@
+/**
+ * @file TestAtmosphereService.cpp
+ * @brief Test codes for AtmosphereService class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <Library/math/Constant.hpp>
+#include <vector>
+
+#include "AtmosphereService.h"
+
+namespace {
+const double kDecyear = 2022.3;  //!< Decimal year of the tests
+
+/**
+ * @fn MakePositions
+ * @brief Return latitude[rad], longitude[rad], and altitude[m] of a constellation
+ */
+std::vector<Vector<3>> MakePositions(const size_t num) {
+  std::vector<Vector<3>> lat_lon_alts(num);
+  for (size_t i = 0; i < num; i++) {
+    lat_lon_alts[i][0] = (-80.0 + 160.0 * i / num) * libra::deg_to_rad;
+    lat_lon_alts[i][1] = (-180.0 + 7.0 * i) * libra::deg_to_rad;
+    lat_lon_alts[i][2] = 250e3 + 2e3 * i;
+  }
+  return lat_lon_alts;
+}
+
+/**
+ * @fn ExpectBatchEqualsSingle
+ * @brief Check that the batch calculation is the same as the calculation of each position
+ */
+void ExpectBatchEqualsSingle(const AtmosphereService& batch, const AtmosphereService& single) {
+  const std::vector<Vector<3>> lat_lon_alts = MakePositions(200);
+  std::vector<double> densities;
+  batch.CalcDensities(lat_lon_alts, kDecyear, densities);
+  ASSERT_EQ(lat_lon_alts.size(), densities.size());
+  for (size_t i = 0; i < lat_lon_alts.size(); i++) {
+    EXPECT_LT(0.0, densities[i]);
+    EXPECT_EQ(single.CalcAirDensity(kDecyear, lat_lon_alts[i]), densities[i]);
+  }
+}
+}  // namespace
+
+TEST(AtmosphereService, BatchStandard) {
+  AtmosphereService service("STANDARD", "", true, 150.0, 150.0, 3.0, false, kDecyear, 86400.0);
+  ExpectBatchEqualsSingle(service, service);
+}
+
+TEST(AtmosphereService, BatchNrlmsise00) {
+  AtmosphereService service("NRLMSISE00", "", true, 150.0, 150.0, 3.0, false, kDecyear, 86400.0);
+  ExpectBatchEqualsSingle(service, service);
+}
+
+TEST(AtmosphereService, BatchNrlmsise00Grid) {
+  // Grids of the same setting are filled in the same order
+  AtmosphereService batch("NRLMSISE00", "", true, 150.0, 150.0, 3.0, false, kDecyear, 86400.0);
+  AtmosphereService single("NRLMSISE00", "", true, 150.0, 150.0, 3.0, false, kDecyear, 86400.0);
+  batch.SetDensityGrid(3600.0, 100e3, 1000e3, 5e3, 5.0 * libra::deg_to_rad, 0.5);
+  single.SetDensityGrid(3600.0, 100e3, 1000e3, 5e3, 5.0 * libra::deg_to_rad, 0.5);
+  ExpectBatchEqualsSingle(batch, single);
+}
+
+TEST(AtmosphereService, GetAirDensity) {
+  AtmosphereService service("NRLMSISE00", "", true, 150.0, 150.0, 3.0, false, kDecyear, 86400.0);
+  std::vector<Vector<3>> lat_lon_alts = MakePositions(10);
+  service.UpdateDensities(lat_lon_alts, kDecyear);
+  for (size_t i = 0; i < lat_lon_alts.size(); i++) {
+    EXPECT_EQ(service.CalcAirDensity(kDecyear, lat_lon_alts[i]), service.GetAirDensity((int)i, kDecyear, lat_lon_alts[i]));
+  }
+
+  // Spacecraft out of the batch, at another position, or at another time are calculated alone
+  Vector<3> moved = lat_lon_alts[3];
+  moved[2] += 10e3;
+  EXPECT_EQ(service.CalcAirDensity(kDecyear, moved), service.GetAirDensity(3, kDecyear, moved));
+  EXPECT_EQ(service.CalcAirDensity(kDecyear, moved), service.GetAirDensity(10, kDecyear, moved));
+  const double next_decyear = kDecyear + 1.0 / (365.0 * 86400.0);
+  EXPECT_EQ(service.CalcAirDensity(next_decyear, lat_lon_alts[3]), service.GetAirDensity(3, next_decyear, lat_lon_alts[3]));
+}
+
+TEST(AtmosphereService, Disabled) {
+  AtmosphereService service("NRLMSISE00", "", true, 150.0, 150.0, 3.0, false, kDecyear, 86400.0);
+  service.IsCalcEnabled = false;
+  std::vector<double> densities;
+  service.CalcDensities(MakePositions(3), kDecyear, densities);
+  ASSERT_EQ(3u, densities.size());
+  for (const double density : densities) {
+    EXPECT_EQ(0.0, density);
+  }
+}
@@ -7,11 +7,14 @@
 #ifndef __Atmosphere_H__
 #define __Atmosphere_H__
 
+#include <Environment/Global/AtmosphereDensityGrid.h>
+#include <Environment/Global/AtmosphereService.h>
 #include <Interface/LogOutput/ILoggable.h>
 #include <Library/nrlmsise00/Wrapper_nrlmsise00.h>
 
 #include <Library/math/Quaternion.hpp>
 #include <Library/math/Vector.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -58,44 +61,68 @@ class Atmosphere : public ILoggable {
    * @brief Return Atmospheric density [kg/m^3]
    */
   double GetAirDensity() const;
+  /**
+   * @fn SetSpaceWeatherInterpolation
+   * @brief Set the interpolation of the space weather parameters between the table rows
+   * @param [in] is_interpolated: Flag to interpolate linearly to the next day (or month) instead of using the row of the day (or month)
+   */
+  inline void SetSpaceWeatherInterpolation(const bool is_interpolated) { is_space_weather_interpolated_ = is_interpolated; }
+  /**
+   * @fn SetDensityGrid
+   * @brief Use the grid cache to calculate the density of the NRLMSISE00 model
+   * @param [in] update_period_s: Period to discard the grid nodes [s]
+   * @param [in] min_altitude_m: Minimum altitude of the grid [m]
+   * @param [in] max_altitude_m: Maximum altitude of the grid [m]
+   * @param [in] altitude_step_m: Grid step of altitude [m]
+   * @param [in] latitude_step_rad: Grid step of latitude [rad]
+   * @param [in] local_time_step_hour: Grid step of local solar time [hour]
+   */
+  void SetDensityGrid(const double update_period_s, const double min_altitude_m, const double max_altitude_m, const double altitude_step_m,
+                      const double latitude_step_rad, const double local_time_step_hour);
+  /**
+   * @fn SetAtmosphereService
+   * @brief Read the density from the atmosphere service shared by all spacecraft instead of the model of this class
+   * @note The density noise of this class is added to the density of the service
+   * @param [in] service: Atmosphere service
+   * @param [in] sat_id: Spacecraft ID to find the density in the batch of the service
+   */
+  void SetAtmosphereService(const AtmosphereService* service, const int sat_id);
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
  private:
-  std::string model_;                  //!< Atmospheric density model name
-  std::string fname_;                  //!< Path and name of initialize file
-  double air_density_;                 //!< Atmospheric density [kg/m^3]
-  double gauss_stddev_;                //!< Standard deviation of density noise (defined as percentage)
-  std::vector<nrlmsise_table> table_;  //!< Space weather table
-  bool is_table_imported_;             //!< Flag of the space weather table is imported or not
-  bool is_manual_param_used_;          //!< Flag to use manual parameters
+  AtmosphereModel model_;                           //!< Atmospheric density model
+  std::string fname_;                               //!< Path and name of initialize file
+  double air_density_;                              //!< Atmospheric density [kg/m^3]
+  double gauss_stddev_;                             //!< Standard deviation of density noise (defined as percentage)
+  std::shared_ptr<const SpaceWeatherTable> table_;  //!< Space weather table shared in the process
+  bool is_space_weather_interpolated_ = false;      //!< Flag to interpolate the space weather parameters
+  bool is_table_imported_;                          //!< Flag of the space weather table is imported or not
+  bool is_manual_param_used_;                       //!< Flag to use manual parameters
 
   // Reference of the following setting parameters https://www.swpc.noaa.gov/phenomena/f107-cm-radio-emissions
   double manual_daily_f107_;    //!< Manual daily f10.7 value
   double manual_average_f107_;  //!< Manual 3-month averaged f10.7 value
   double manual_ap_;            //!< Manual ap value Ref: http://wdc.kugi.kyoto-u.ac.jp/kp/kpexp-j.html
 
+  std::shared_ptr<AtmosphereDensityGrid> grid_;  //!< Grid cache of the NRLMSISE00 density (nullptr for the direct calculation)
+  const AtmosphereService* service_ = nullptr;   //!< Atmosphere service shared by all spacecraft (nullptr to use the model of this class)
+  int sat_id_ = 0;                               //!< Spacecraft ID in the atmosphere service
+
   //  double rw_stepwidth_;
   //  double rw_stddev_;
   //  double rw_limit_;
 
-  /**
-   * @fn CalcStandard
-   * @brief Calculate atmospheric density with simplest method
-   * @param [in] altitude_m: Altitude of spacecraft [m]
-   * @return Atmospheric density [kg/m^3]
-   */
-  double CalcStandard(double altitude_m);
   /**
    * @fn GetSpaceWeatherTable
    * @param [in] decyear: Decimal year of simulation start [year]
@@ -6,7 +6,10 @@
 #include "InitLocalEnvironment.hpp"
 
 #include <Interface/InitInput/IniAccess.h>
+#include <Library/math/Constant.hpp>
 
+#include <cstdlib>
+#include <iostream>
 #include <string>
 
 #define CALC_LABEL "calculation"
@@ -22,6 +25,7 @@ MagEnvironment InitMagEnvironment(std::string ini_path) {
   double mag_wnvar = conf.ReadDouble(section, "mag_wnvar");
 
   MagEnvironment mag_env(fname, mag_rwdev, mag_rwlimit, mag_wnvar);
+  mag_env.SetCoeffUpdateInterval(conf.ReadDouble(section, "coeff_update_interval_hour"));
   mag_env.IsCalcEnabled = conf.ReadEnable(section, CALC_LABEL);
   mag_env.IsLogEnabled = conf.ReadEnable(section, LOG_LABEL);
 
@@ -66,6 +70,20 @@ Atmosphere InitAtmosphere(std::string ini_path) {
   double manual_ap = conf.ReadDouble(section, "manual_ap");
 
   Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap);
+  atmosphere.SetSpaceWeatherInterpolation(conf.ReadEnable(section, "space_weather_interpolation"));
+  if (conf.ReadEnable(section, "is_density_cache_enabled")) {
+    double update_period_s = conf.ReadDouble(section, "density_cache_update_period_s");
+    double min_altitude_m = conf.ReadDouble(section, "density_cache_min_altitude_km") * 1000.0;
+    double max_altitude_m = conf.ReadDouble(section, "density_cache_max_altitude_km") * 1000.0;
+    double altitude_step_m = conf.ReadDouble(section, "density_cache_altitude_step_km") * 1000.0;
+    double latitude_step_rad = conf.ReadDouble(section, "density_cache_latitude_step_deg") * libra::deg_to_rad;
+    double local_time_step_hour = conf.ReadDouble(section, "density_cache_local_time_step_hour");
+    if (!(altitude_step_m > 0.0) || !(latitude_step_rad > 0.0) || !(local_time_step_hour > 0.0)) {
+      std::cerr << "Steps of the density cache must be positive. Check [ATMOSPHERE] section in LocalEnvironment.ini." << std::endl;
+      exit(1);
+    }
+    atmosphere.SetDensityGrid(update_period_s, min_altitude_m, max_altitude_m, altitude_step_m, latitude_step_rad, local_time_step_hour);
+  }
   atmosphere.IsCalcEnabled = conf.ReadEnable(section, CALC_LABEL);
   atmosphere.IsLogEnabled = conf.ReadEnable(section, LOG_LABEL);
 
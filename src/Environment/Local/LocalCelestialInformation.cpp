@@ -6,7 +6,6 @@
 #include "LocalCelestialInformation.h"
 
 #include <Interface/LogOutput/LogUtility.h>
-#include <SpiceUsr.h>
 
 #include <iostream>
 #include <sstream>
@@ -126,67 +125,53 @@ void Convert_i2b_velocity(const double* r_i, const double* v_i, double* v_b, Qua
   }
 }
 
-Vector<3> LocalCelestialInformation::GetPosFromSC_i(const char* body_name) const {
+Vector<3> LocalCelestialInformation::GetPosFromSC_i(const int id) const {
   Vector<3> position;
-  int index = 0;
-  index = glo_celes_info_->CalcBodyIdFromName(body_name);
   for (int i = 0; i < 3; i++) {
-    position[i] = celes_objects_pos_from_sc_i_[index * 3 + i];
+    position[i] = celes_objects_pos_from_sc_i_[id * 3 + i];
   }
   return position;
 }
 
-Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_i() const {
-  string body_name = glo_celes_info_->GetCenterBodyName();
-  Vector<3> position = GetPosFromSC_i(body_name.c_str());
-  return position;
+Vector<3> LocalCelestialInformation::GetPosFromSC_i(const char* body_name) const {
+  int index = glo_celes_info_->CalcBodyIdFromName(body_name);
+  return GetPosFromSC_i(index);
 }
 
-Vector<3> LocalCelestialInformation::GetPosFromSC_b(const char* body_name) const {
+Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_i() const { return GetPosFromSC_i(glo_celes_info_->GetCenterBodyId()); }
+
+Vector<3> LocalCelestialInformation::GetPosFromSC_b(const int id) const {
   Vector<3> position;
-  int index = 0;
-  index = glo_celes_info_->CalcBodyIdFromName(body_name);
   for (int i = 0; i < 3; i++) {
-    position[i] = celes_objects_pos_from_sc_b_[index * 3 + i];
+    position[i] = celes_objects_pos_from_sc_b_[id * 3 + i];
   }
   return position;
 }
 
-Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_b(void) const {
-  string body_name = glo_celes_info_->GetCenterBodyName();
-  Vector<3> position = GetPosFromSC_b(body_name.c_str());
-  return position;
+Vector<3> LocalCelestialInformation::GetPosFromSC_b(const char* body_name) const {
+  int index = glo_celes_info_->CalcBodyIdFromName(body_name);
+  return GetPosFromSC_b(index);
 }
 
-string LocalCelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int maxlen = 100;
-  char namebuf[maxlen];
-  string str_tmp = "";
+Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_b(void) const { return GetPosFromSC_b(glo_celes_info_->GetCenterBodyId()); }
+
+void LocalCelestialInformation::GetLogSchema(LogSchema& schema) const {
   for (int i = 0; i < glo_celes_info_->GetNumBody(); i++) {
-    SpiceInt planet_id = glo_celes_info_->GetSelectedBody()[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    string name = namebuf;
-    string body_pos = name + "_pos";
-    string body_vel = name + "_vel";
+    const string& name = glo_celes_info_->GetBodyName(i);
     // 　OUTPUT ONLY POS/VEL LOOKED FROM S/C AT THIS MOMENT
-    str_tmp += WriteVector(body_pos, "b", "m", 3);
-    str_tmp += WriteVector(body_vel, "b", "m/s", 3);
+    schema.AddVector(name + "_pos", "b", "m", 3);
+    schema.AddVector(name + "_vel", "b", "m/s", 3);
   }
-  return str_tmp;
 }
 
-string LocalCelestialInformation::GetLogValue() const {
-  string str_tmp = "";
+void LocalCelestialInformation::LogValues(LogSink& sink) const {
   for (int i = 0; i < glo_celes_info_->GetNumBody(); i++) {
     // 　OUTPUT ONLY POS/VEL LOOKED FROM S/C AT THIS MOMENT
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celes_objects_pos_from_sc_b_[i * 3 + j]);
+      sink.Add(celes_objects_pos_from_sc_b_[i * 3 + j]);
     }
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celes_objects_vel_from_sc_b_[i * 3 + j]);
+      sink.Add(celes_objects_vel_from_sc_b_[i * 3 + j]);
     }
   }
-  return str_tmp;
 }
@@ -44,6 +44,12 @@ class LocalCelestialInformation : public ILoggable {
    */
   void CalcAllPosVel_b(Quaternion q_i2b, const Vector<3> sc_body_rate);
 
+  /**
+   * @fn GetPosFromSC_i
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] id: ID of CelestialInformation list (see CelestialInformation::CalcBodyIdFromName)
+   */
+  Vector<3> GetPosFromSC_i(const int id) const;
   /**
    * @fn GetPosFromSC_i
    * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
@@ -56,6 +62,12 @@ class LocalCelestialInformation : public ILoggable {
    */
   Vector<3> GetCenterBodyPosFromSC_i(void) const;
 
+  /**
+   * @fn GetPosFromSC_b
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] id: ID of CelestialInformation list (see CelestialInformation::CalcBodyIdFromName)
+   */
+  Vector<3> GetPosFromSC_b(const int id) const;
   /**
    * @fn GetPosFromSC_b
    * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
@@ -76,15 +88,15 @@ class LocalCelestialInformation : public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
  private:
   const CelestialInformation* glo_celes_info_;  //!< Global celestial information
@@ -32,6 +32,9 @@ void LocalEnvironment::Initialize(SimulationConfig* sim_config, const GlobalEnvi
   atmosphere_ = new Atmosphere(InitAtmosphere(ini_fname));
   celes_info_ = new LocalCelestialInformation(&(glo_env->GetCelesInfo()));
   srp_ = new SRPEnvironment(InitSRPEnvironment(ini_fname, celes_info_));
+  if (glo_env->GetAtmosphereService().IsCalcEnabled) {
+    atmosphere_->SetAtmosphereService(&(glo_env->GetAtmosphereService()), sat_id);
+  }
   // Force to disable when the center body is not the Earth
   if (glo_env->GetCelesInfo().GetCenterBodyName() != "EARTH") {
     mag_->IsCalcEnabled = false;
@@ -61,8 +64,8 @@ void LocalEnvironment::Update(const Dynamics* dynamics, const SimTime* sim_time)
 }
 
 void LocalEnvironment::LogSetup(Logger& logger) {
-  logger.AddLoggable(mag_);
-  logger.AddLoggable(srp_);
-  logger.AddLoggable(atmosphere_);
-  logger.AddLoggable(celes_info_);
+  logger.AddLoggable(mag_, "environment");
+  logger.AddLoggable(srp_, "environment");
+  logger.AddLoggable(atmosphere_, "environment");
+  logger.AddLoggable(celes_info_, "celestial");
 }
@@ -6,7 +6,6 @@
 #include "MagEnvironment.h"
 
 #include <Interface/InitInput/IniAccess.h>
-#include <Library/igrf/igrf.h>
 #include <Library/math/GlobalRand.h>
 
 #include <Library/math/NormalRand.hpp>
@@ -16,14 +15,19 @@ using libra::NormalRand;
 using namespace std;
 
 MagEnvironment::MagEnvironment(string fname, double mag_rwdev, double mag_rwlimit, double mag_wnvar)
-    : mag_rwdev_(mag_rwdev), mag_rwlimit_(mag_rwlimit), mag_wnvar_(mag_wnvar), fname_(fname) {
+    : mag_rwdev_(mag_rwdev),
+      mag_rwlimit_(mag_rwlimit),
+      mag_wnvar_(mag_wnvar),
+      fname_(fname),
+      igrf_model_(IgrfCoefficients::Load(fname)),
+      random_walk_(0.1, Vector<3>(mag_rwdev), Vector<3>(mag_rwlimit)),
+      white_noise_(0.0, mag_wnvar, g_rand.MakeSeed()) {
   for (int i = 0; i < 3; ++i) {
     Mag_i_[i] = 0;
   }
   for (int i = 0; i < 3; ++i) {
     Mag_b_[i] = 0;
   }
-  set_file_path(fname_.c_str());
 }
 
 void MagEnvironment::CalcMag(double decyear, double side, Vector<3> lat_lon_alt, Quaternion q_i2b) {
@@ -34,7 +38,7 @@ void MagEnvironment::CalcMag(double decyear, double side, Vector<3> lat_lon_alt,
   double alt = lat_lon_alt(2);
 
   double mag_i_array[3];
-  IgrfCalc(decyear, latrad, lonrad, alt, side, mag_i_array);
+  igrf_model_.CalcMagEci(decyear, latrad, lonrad, alt, side, mag_i_array);
   AddNoise(mag_i_array);
   for (int i = 0; i < 3; ++i) {
     Mag_i_[i] = mag_i_array[i];
@@ -42,35 +46,27 @@ void MagEnvironment::CalcMag(double decyear, double side, Vector<3> lat_lon_alt,
   Mag_b_ = q_i2b.frame_conv(Mag_i_);
 }
 
+void MagEnvironment::SetCoeffUpdateInterval(const double interval_hour) {
+  igrf_model_.SetCoefficientUpdateInterval(interval_hour / (365.25 * 24.0));
+}
+
 void MagEnvironment::AddNoise(double* mag_i_array) {
-  static Vector<3> stddev(mag_rwdev_);
-  static Vector<3> limit(mag_rwlimit_);
-  static RandomWalk<3> rw(0.1, stddev, limit);
-  static NormalRand nr(0.0, mag_wnvar_, g_rand.MakeSeed());
   for (int i = 0; i < 3; ++i) {
-    mag_i_array[i] += rw[i] + nr;
+    mag_i_array[i] += random_walk_[i] + white_noise_;
   }
-  ++rw;  // Update random walk
+  ++random_walk_;  // Update random walk
 }
 
 Vector<3> MagEnvironment::GetMag_i() const { return Mag_i_; }
 
 Vector<3> MagEnvironment::GetMag_b() const { return Mag_b_; }
 
-string MagEnvironment::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector("mag", "i", "nT", 3);
-  str_tmp += WriteVector("mag", "b", "nT", 3);
-
-  return str_tmp;
+void MagEnvironment::GetLogSchema(LogSchema& schema) const {
+  schema.AddVector("mag", "i", "nT", 3);
+  schema.AddVector("mag", "b", "nT", 3);
 }
 
-string MagEnvironment::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector(Mag_i_);
-  str_tmp += WriteVector(Mag_b_);
-
-  return str_tmp;
+void MagEnvironment::LogValues(LogSink& sink) const {
+  sink.Add(Mag_i_);
+  sink.Add(Mag_b_);
 }
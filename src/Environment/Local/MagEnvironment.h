@@ -11,6 +11,9 @@ using libra::Vector;
 using libra::Quaternion;
 
 #include <Interface/LogOutput/ILoggable.h>
+#include <Library/igrf/IgrfModel.h>
+#include <Library/math/NormalRand.hpp>
+#include <Library/math/RandomWalk.hpp>
 
 /**
  * @class MagEnvironment
@@ -44,6 +47,12 @@ class MagEnvironment : public ILoggable {
    * @param [in] q_i2b: Spacecraft attitude quaternion from the inertial frame to the body fixed frame
    */
   void CalcMag(double decyear, double side, Vector<3> lat_lon_alt, Quaternion q_i2b);
+  /**
+   * @fn SetCoeffUpdateInterval
+   * @brief Set the update interval of the time-dependent IGRF coefficients
+   * @param [in] interval_hour: Update interval [hour]. The coefficients are updated at every calculation when it is zero.
+   */
+  void SetCoeffUpdateInterval(const double interval_hour);
 
   /**
    * @fn GetMag_i
@@ -58,15 +67,15 @@ class MagEnvironment : public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
  private:
   Vector<3> Mag_i_;     //!< Magnetic field vector at the inertial frame
@@ -76,6 +85,10 @@ class MagEnvironment : public ILoggable {
   double mag_wnvar_;    //!< Standard deviation of white noise [nT]
   std::string fname_;   //!< Path to the initialize file
 
+  IgrfModel igrf_model_;           //!< IGRF model
+  RandomWalk<3> random_walk_;      //!< Random walk noise
+  libra::NormalRand white_noise_;  //!< White noise
+
   /**
    * @fn AddNoise
    * @brief Add magnetic field noise
@@ -20,18 +20,20 @@ SRPEnvironment::SRPEnvironment(LocalCelestialInformation* local_celes_info) : lo
   solar_constant_ = 1366.0;                                       // [W/m2]
   pressure_ = solar_constant_ / environment::speed_of_light_m_s;  // [N/m2]
   shadow_source_name_ = local_celes_info_->GetGlobalInfo().GetCenterBodyName();
-  sun_radius_m_ = local_celes_info_->GetGlobalInfo().GetMeanRadiusFromName("SUN");
+  sun_id_ = local_celes_info_->GetGlobalInfo().CalcBodyIdFromName("SUN");
+  shadow_source_id_ = local_celes_info_->GetGlobalInfo().CalcBodyIdFromName(shadow_source_name_.c_str());
+  sun_radius_m_ = local_celes_info_->GetGlobalInfo().GetMeanRadius(sun_id_);
 }
 
 void SRPEnvironment::UpdateAllStates() {
   if (!IsCalcEnabled) return;
 
   UpdatePressure();
-  CalcShadowCoefficient(shadow_source_name_);
+  CalcShadowCoefficient(shadow_source_id_);
 }
 
 void SRPEnvironment::UpdatePressure() {
-  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i("SUN");
+  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i(sun_id_);
   const double distance_sat_to_sun = norm(r_sc2sun_eci);
   pressure_ = solar_constant_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun / environment::astronomical_unit_m, 2.0);
 }
@@ -46,34 +48,26 @@ double SRPEnvironment::GetSolarConstant() const { return solar_constant_; }
 
 double SRPEnvironment::GetShadowCoefficient() const { return shadow_coefficient_; }
 
-string SRPEnvironment::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteScalar("sr_pressure", "N/m^2");
-  str_tmp += WriteScalar("shadow coefficient");
-
-  return str_tmp;
+void SRPEnvironment::GetLogSchema(LogSchema& schema) const {
+  schema.AddScalar("sr_pressure", "N/m^2");
+  schema.AddColumn("shadow coefficient");
 }
 
-string SRPEnvironment::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteScalar(pressure_ * shadow_coefficient_);
-  str_tmp += WriteScalar(shadow_coefficient_);
-
-  return str_tmp;
+void SRPEnvironment::LogValues(LogSink& sink) const {
+  sink.Add(pressure_ * shadow_coefficient_);
+  sink.Add(shadow_coefficient_);
 }
 
-void SRPEnvironment::CalcShadowCoefficient(string shadow_source_name) {
-  if (shadow_source_name == "SUN") {
+void SRPEnvironment::CalcShadowCoefficient(const int shadow_source_id) {
+  if (shadow_source_id == sun_id_) {
     shadow_coefficient_ = 1.0;
     return;
   }
 
-  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i("SUN");
-  const Vector<3> r_sc2source_eci = local_celes_info_->GetPosFromSC_i(shadow_source_name.c_str());
+  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i(sun_id_);
+  const Vector<3> r_sc2source_eci = local_celes_info_->GetPosFromSC_i(shadow_source_id);
 
-  const double shadow_source_radius_m = local_celes_info_->GetGlobalInfo().GetMeanRadiusFromName(shadow_source_name.c_str());
+  const double shadow_source_radius_m = local_celes_info_->GetGlobalInfo().GetMeanRadius(shadow_source_id);
 
   const double distance_sat_to_sun = norm(r_sc2sun_eci);
   const double sd_sun = asin(sun_radius_m_ / distance_sat_to_sun);                // Apparent radius of the sun
@@ -75,15 +75,15 @@ class SRPEnvironment : public ILoggable {
 
   // Override ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn GetLogSchema
+   * @brief Override GetLogSchema function of ILoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LogValues
+   * @brief Override LogValues function of ILoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
  private:
   double pressure_;                  //!< Solar radiation pressure [N/m^2]
@@ -91,15 +91,17 @@ class SRPEnvironment : public ILoggable {
   double shadow_coefficient_ = 1.0;  //!< shadow function
   double sun_radius_m_;              //!< Sun radius [m]
   std::string shadow_source_name_;   //!< Shadow source name
+  int sun_id_;                       //!< ID of the sun in the CelestialInformation list
+  int shadow_source_id_;             //!< ID of the shadow source in the CelestialInformation list
 
   LocalCelestialInformation* local_celes_info_;  //!< Local celestial information
 
   /**
    * @fn CalcShadowCoefficient
    * @brief Calculate shadow coefficient
-   * @param [in] shadow_source_name_: Shadow source name
+   * @param [in] shadow_source_id: ID of the shadow source in the CelestialInformation list
    */
-  void CalcShadowCoefficient(std::string shadow_source_name);
+  void CalcShadowCoefficient(const int shadow_source_id);
 };
 
 #endif /* SRPEnvironment_h */
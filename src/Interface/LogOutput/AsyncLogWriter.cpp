@@ -0,0 +1,166 @@
+/**
+ * @file AsyncLogWriter.cpp
+ * @brief Background writer of the log records
+ */
+
+#include "AsyncLogWriter.h"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace std;
+
+AsyncLogWriter::AsyncLogWriter(ostream& stream, const size_t num_of_buffers, const size_t buffer_size)
+    : stream_(stream),
+      buffers_(num_of_buffers > 1 ? num_of_buffers : 2),
+      buffer_size_(buffer_size),
+      write_index_(0),
+      num_of_committed_(0),
+      is_writer_waiting_(false),
+      is_stopped_(false),
+      current_buffer_(nullptr),
+      num_of_stalls_(0),
+      formatter_(formatted_) {
+  // Reserve margin for the line which exceeds the buffer size
+  for (auto& buffer : buffers_) buffer.reserve(buffer_size_ * 2);
+  // The text is longer than the raw records
+  formatted_.reserve(buffer_size_ * 4);
+  writer_thread_ = thread(&AsyncLogWriter::WriterLoop, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+  Commit();
+  {
+    lock_guard<mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  committed_cv_.notify_one();
+  writer_thread_.join();
+  stream_.flush();
+}
+
+void AsyncLogWriter::SetSchema(const LogSchema& schema) {
+  // The writer thread does not touch the converter while no buffer is passed
+  Flush();
+  formatter_.SetSchema(schema);
+}
+
+void AsyncLogWriter::Append(const string& log) { AppendRecord(RecordType::Text, log.data(), log.size()); }
+
+void AsyncLogWriter::BeginRow() { AppendRecord(RecordType::BeginRow, nullptr, 0); }
+
+void AsyncLogWriter::AddDouble(const double value) { AppendRecord(RecordType::Double, &value, sizeof(value)); }
+
+void AsyncLogWriter::AddInteger(const long long value) {
+  const int64_t value64 = value;
+  AppendRecord(RecordType::Integer, &value64, sizeof(value64));
+}
+
+void AsyncLogWriter::AddCsvValues(const string& values) { AppendRecord(RecordType::CsvValues, values.data(), values.size()); }
+
+void AsyncLogWriter::AppendRecord(const RecordType type, const void* data, const size_t size) {
+  if (current_buffer_ == nullptr) current_buffer_ = &AcquireBuffer();
+  current_buffer_->push_back((char)type);
+  if (type == RecordType::Text || type == RecordType::CsvValues) {
+    const uint32_t length = (uint32_t)size;
+    current_buffer_->append(reinterpret_cast<const char*>(&length), sizeof(length));
+  }
+  current_buffer_->append(static_cast<const char*>(data), size);
+}
+
+void AsyncLogWriter::Format(const string& buffer) {
+  formatted_.clear();
+  const char* head = buffer.data();
+  const char* end = head + buffer.size();
+  while (head < end) {
+    const RecordType type = (RecordType)*head++;
+    switch (type) {
+      case RecordType::Text:
+      case RecordType::CsvValues: {
+        uint32_t length;
+        memcpy(&length, head, sizeof(length));
+        head += sizeof(length);
+        if (type == RecordType::Text) {
+          formatted_.append(head, length);
+        } else {
+          csv_values_.assign(head, length);
+          formatter_.AddCsvValues(csv_values_);
+        }
+        head += length;
+        break;
+      }
+      case RecordType::Double: {
+        double value;
+        memcpy(&value, head, sizeof(value));
+        head += sizeof(value);
+        formatter_.AddDouble(value);
+        break;
+      }
+      case RecordType::Integer: {
+        int64_t value;
+        memcpy(&value, head, sizeof(value));
+        head += sizeof(value);
+        formatter_.AddInteger(value);
+        break;
+      }
+      case RecordType::BeginRow:
+        formatter_.BeginRow();
+        break;
+    }
+  }
+}
+
+void AsyncLogWriter::EndLine() {
+  if (current_buffer_ != nullptr && current_buffer_->size() >= buffer_size_) Commit();
+}
+
+void AsyncLogWriter::Flush() {
+  Commit();
+  unique_lock<mutex> lock(mutex_);
+  written_cv_.wait(lock, [this] { return num_of_committed_ == 0; });
+  // The writer thread does not touch the stream while no buffer is passed
+  stream_.flush();
+}
+
+void AsyncLogWriter::Commit() {
+  if (current_buffer_ == nullptr) return;
+  bool is_writer_waiting;
+  {
+    lock_guard<mutex> lock(mutex_);
+    num_of_committed_++;
+    is_writer_waiting = is_writer_waiting_;
+  }
+  current_buffer_ = nullptr;
+  if (is_writer_waiting) committed_cv_.notify_one();
+}
+
+string& AsyncLogWriter::AcquireBuffer() {
+  unique_lock<mutex> lock(mutex_);
+  if (num_of_committed_ >= buffers_.size()) {
+    num_of_stalls_++;
+    written_cv_.wait(lock, [this] { return num_of_committed_ < buffers_.size(); });
+  }
+  return buffers_[(write_index_ + num_of_committed_) % buffers_.size()];
+}
+
+void AsyncLogWriter::WriterLoop() {
+  unique_lock<mutex> lock(mutex_);
+  while (true) {
+    is_writer_waiting_ = true;
+    committed_cv_.wait(lock, [this] { return num_of_committed_ > 0 || is_stopped_; });
+    is_writer_waiting_ = false;
+    if (num_of_committed_ == 0) break;  // Stopped and all buffers are written
+
+    // The passed buffer is not touched by the simulation thread
+    string& buffer = buffers_[write_index_];
+    lock.unlock();
+    Format(buffer);
+    stream_.write(formatted_.data(), formatted_.size());
+    buffer.clear();  // Keep the capacity
+    lock.lock();
+
+    write_index_ = (write_index_ + 1) % buffers_.size();
+    num_of_committed_--;
+    written_cv_.notify_one();
+  }
+}
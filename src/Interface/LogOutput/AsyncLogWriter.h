@@ -0,0 +1,163 @@
+/**
+ * @file AsyncLogWriter.h
+ * @brief Background writer of the log records
+ */
+
+#ifndef __ASYNC_LOG_WRITER_H__
+#define __ASYNC_LOG_WRITER_H__
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CsvLogSink.h"
+#include "LogSchema.h"
+#include "LogSink.h"
+
+/**
+ * @class AsyncLogWriter
+ * @brief Background writer of the log records
+ * @note The buffers are a preallocated ring. The simulation thread appends records to a buffer and passes it to the writer thread when
+ *       the buffer is full, and the writer thread writes the passed buffers to the stream in order. When all buffers are passed and not
+ *       written yet, the simulation thread waits for the writer thread. The remaining records are written and the stream is flushed in
+ *       the destructor.
+ * @note The values written through the LogSink interface are stored as raw binary records, and they are converted to the CSV text on
+ *       the writer thread with the precisions of the schema. Thus the simulation thread does not format the numbers.
+ */
+class AsyncLogWriter : public LogSink {
+ public:
+  /**
+   * @fn AsyncLogWriter
+   * @brief Constructor
+   * @param [in] stream: Output stream. The stream must not be used by the others until this writer is destructed.
+   * @param [in] num_of_buffers: Number of buffers in the ring
+   * @param [in] buffer_size: Size of each buffer [byte]
+   */
+  AsyncLogWriter(std::ostream& stream, const size_t num_of_buffers, const size_t buffer_size = 65536);
+  /**
+   * @fn ~AsyncLogWriter
+   * @brief Destructor. Write the remaining lines and stop the writer thread.
+   */
+  ~AsyncLogWriter();
+
+  /**
+   * @fn SetSchema
+   * @brief Set the precision of each column used to convert the values on the writer thread
+   * @note This waits until the passed buffers are written, so call this before writing the values (e.g., with the header).
+   * @param [in] schema: Schema of the values in a row
+   */
+  void SetSchema(const LogSchema& schema);
+  /**
+   * @fn Append
+   * @brief Append the string to the current buffer. The string is written as it is.
+   * @param [in] log: String to append
+   */
+  void Append(const std::string& log);
+  /**
+   * @fn BeginRow
+   * @brief Start a row of the values from the first column of the schema
+   */
+  void BeginRow();
+  /**
+   * @fn EndLine
+   * @brief Finish a line. The current buffer is passed to the writer thread when it is full.
+   */
+  void EndLine();
+  /**
+   * @fn Flush
+   * @brief Pass the current buffer and wait until all passed buffers are written and the stream is flushed
+   */
+  void Flush();
+
+  /**
+   * @fn GetNumOfStalls
+   * @brief Return the number of times the simulation thread waited for a free buffer
+   */
+  inline unsigned long long GetNumOfStalls() const { return num_of_stalls_; }
+
+  // Override LogSink
+  /**
+   * @fn AddDouble
+   * @brief Override AddDouble function of LogSink. The value is converted on the writer thread.
+   */
+  virtual void AddDouble(const double value);
+  /**
+   * @fn AddInteger
+   * @brief Override AddInteger function of LogSink. The value is converted on the writer thread.
+   */
+  virtual void AddInteger(const long long value);
+  /**
+   * @fn AddCsvValues
+   * @brief Override AddCsvValues function of LogSink. The text is written as it is.
+   */
+  virtual void AddCsvValues(const std::string& values);
+
+ private:
+  /**
+   * @enum RecordType
+   * @brief Type of the records in the buffers
+   */
+  enum class RecordType : char {
+    Text,       //!< Text written as it is (32bit length and bytes)
+    CsvValues,  //!< Values already converted by the loggable (32bit length and bytes)
+    Double,     //!< Floating point value (64bit)
+    Integer,    //!< Integer value (64bit)
+    BeginRow,   //!< Start of a row
+  };
+
+  std::ostream& stream_;              //!< Output stream
+  std::vector<std::string> buffers_;  //!< Ring of the buffers
+  size_t buffer_size_;                //!< Size of each buffer [byte]
+  size_t write_index_;                //!< Index of the oldest passed buffer
+  size_t num_of_committed_;           //!< Number of passed buffers which are not written yet
+  bool is_writer_waiting_;            //!< Is the writer thread waiting for a buffer?
+  bool is_stopped_;                   //!< Stop request to the writer thread
+  std::string* current_buffer_;       //!< Buffer filled by the simulation thread (nullptr when not acquired)
+  unsigned long long num_of_stalls_;  //!< Number of waits for a free buffer
+
+  // Owned by the writer thread
+  std::string formatted_;   //!< Text converted from a passed buffer
+  std::string csv_values_;  //!< Values of a CsvValues record
+  CsvLogSink formatter_;    //!< Converter of the values to the CSV text
+
+  std::mutex mutex_;                      //!< Mutex for the indices and the flags
+  std::condition_variable committed_cv_;  //!< Notified when a buffer is passed or stop is requested
+  std::condition_variable written_cv_;    //!< Notified when buffers are written
+  std::thread writer_thread_;             //!< Writer thread
+
+  /**
+   * @fn AcquireBuffer
+   * @brief Return the buffer to fill. Wait when all buffers are passed.
+   */
+  std::string& AcquireBuffer();
+  /**
+   * @fn AppendRecord
+   * @brief Append a record to the current buffer
+   * @param [in] type: Type of the record
+   * @param [in] data: Head pointer of the payload
+   * @param [in] size: Size of the payload [byte]
+   */
+  void AppendRecord(const RecordType type, const void* data, const size_t size);
+  /**
+   * @fn Format
+   * @brief Convert the records in the buffer to the text in formatted_
+   * @param [in] buffer: Passed buffer
+   */
+  void Format(const std::string& buffer);
+  /**
+   * @fn Commit
+   * @brief Pass the current buffer to the writer thread
+   */
+  void Commit();
+  /**
+   * @fn WriterLoop
+   * @brief Main loop of the writer thread
+   */
+  void WriterLoop();
+};
+
+#endif  //__ASYNC_LOG_WRITER_H__
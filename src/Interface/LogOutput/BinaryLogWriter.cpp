@@ -0,0 +1,165 @@
+/**
+ * @file BinaryLogWriter.cpp
+ * @brief Writer of the binary columnar log
+ */
+
+#include "BinaryLogWriter.h"
+
+#include <cstring>
+
+using namespace std;
+
+const char BinaryLogWriter::kMagic[8] = {'S', '2', 'E', 'B', 'L', 'O', 'G', '\0'};
+const char BinaryLogWriter::kFooterMagic[8] = {'S', '2', 'E', 'B', 'L', 'E', 'N', 'D'};
+
+/**
+ * @fn AppendRaw
+ * @brief Append the bytes of the value in the host byte order (little endian on the supported platforms)
+ */
+template <typename T>
+static void AppendRaw(string& bytes, const T value) {
+  char raw[sizeof(T)];
+  memcpy(raw, &value, sizeof(T));
+  bytes.append(raw, sizeof(T));
+}
+
+/**
+ * @fn AppendString
+ * @brief Append the length and the characters of the string
+ */
+static void AppendString(string& bytes, const string& str) {
+  AppendRaw(bytes, (uint32_t)str.size());
+  bytes.append(str);
+}
+
+/**
+ * @fn AppendPadding
+ * @brief Append zeros to align the size to 8 bytes
+ */
+static void AppendPadding(string& bytes) {
+  while (bytes.size() % 8 != 0) bytes.push_back('\0');
+}
+
+BinaryLogWriter::BinaryLogWriter(const function<void(const string&)>& output, const size_t rows_per_chunk)
+    : output_(output),
+      rows_per_chunk_(rows_per_chunk > 0 ? rows_per_chunk : 1),
+      num_rows_(0),
+      column_(0),
+      first_row_(0),
+      offset_(0),
+      is_started_(false),
+      is_finished_(false) {}
+
+void BinaryLogWriter::Start(const LogSchema& schema) {
+  if (is_started_) return;
+  is_started_ = true;
+
+  const vector<LogField>& fields = schema.GetFields();
+  bytes_.append(kMagic, sizeof(kMagic));
+  AppendRaw(bytes_, kVersion);
+  AppendRaw(bytes_, (uint32_t)fields.size());
+  AppendRaw(bytes_, (uint64_t)schema.GetNumOfColumns());
+  for (const auto& field : fields) {
+    AppendString(bytes_, field.name);
+    AppendString(bytes_, field.frame);
+    AppendString(bytes_, field.unit);
+    AppendRaw(bytes_, (uint32_t)field.type);
+    AppendRaw(bytes_, (uint32_t)field.rows);
+    AppendRaw(bytes_, (uint32_t)field.cols);
+    AppendRaw(bytes_, (uint32_t)field.precision);
+    AppendRaw(bytes_, (uint32_t)field.column_names.size());
+    for (const auto& column_name : field.column_names) AppendString(bytes_, column_name);
+  }
+  AppendPadding(bytes_);
+  Output();
+
+  column_types_.clear();
+  for (size_t column = 0; column < schema.GetNumOfColumns(); column++) column_types_.push_back(schema.GetColumnType(column));
+  values_.assign(column_types_.size() * rows_per_chunk_, 0);
+}
+
+void BinaryLogWriter::AddDouble(const double value) {
+  if (column_ >= column_types_.size()) {
+    column_++;
+    return;
+  }
+  uint64_t raw;
+  if (column_types_[column_] == LogValueType::Int64) {
+    const int64_t integer = (int64_t)value;
+    memcpy(&raw, &integer, sizeof(raw));
+  } else {
+    memcpy(&raw, &value, sizeof(raw));
+  }
+  SetValue(raw);
+}
+
+void BinaryLogWriter::AddInteger(const long long value) {
+  if (column_ >= column_types_.size()) {
+    column_++;
+    return;
+  }
+  uint64_t raw;
+  if (column_types_[column_] == LogValueType::Double) {
+    const double real = (double)value;
+    memcpy(&raw, &real, sizeof(raw));
+  } else {
+    const int64_t integer = value;
+    memcpy(&raw, &integer, sizeof(raw));
+  }
+  SetValue(raw);
+}
+
+void BinaryLogWriter::SetValue(const uint64_t raw) {
+  values_[column_ * rows_per_chunk_ + num_rows_] = raw;
+  column_++;
+}
+
+void BinaryLogWriter::EndRow() {
+  if (!is_started_ || is_finished_) return;
+  // Fill the lacking values with zero
+  for (; column_ < column_types_.size(); column_++) values_[column_ * rows_per_chunk_ + num_rows_] = 0;
+  column_ = 0;
+  num_rows_++;
+  if (num_rows_ >= rows_per_chunk_) WriteChunk();
+}
+
+void BinaryLogWriter::Finish() {
+  if (!is_started_ || is_finished_) return;
+  is_finished_ = true;
+  WriteChunk();
+
+  const uint64_t index_offset = offset_;
+  bytes_.append("INDX", 4);
+  AppendRaw(bytes_, (uint32_t)0);
+  AppendRaw(bytes_, (uint64_t)chunk_index_.size());
+  for (const auto& chunk : chunk_index_) {
+    AppendRaw(bytes_, chunk.offset);
+    AppendRaw(bytes_, chunk.first_row);
+    AppendRaw(bytes_, chunk.num_rows);
+  }
+  AppendRaw(bytes_, index_offset);
+  bytes_.append(kFooterMagic, sizeof(kFooterMagic));
+  Output();
+}
+
+void BinaryLogWriter::WriteChunk() {
+  if (num_rows_ == 0) return;
+  chunk_index_.push_back(ChunkIndex{offset_, first_row_, num_rows_});
+
+  bytes_.append("CHNK", 4);
+  AppendRaw(bytes_, (uint32_t)num_rows_);
+  AppendRaw(bytes_, first_row_);
+  for (size_t column = 0; column < column_types_.size(); column++) {
+    bytes_.append((const char*)&values_[column * rows_per_chunk_], num_rows_ * sizeof(uint64_t));
+  }
+  Output();
+
+  first_row_ += num_rows_;
+  num_rows_ = 0;
+}
+
+void BinaryLogWriter::Output() {
+  output_(bytes_);
+  offset_ += bytes_.size();
+  bytes_.clear();
+}
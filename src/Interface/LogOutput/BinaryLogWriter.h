@@ -0,0 +1,110 @@
+/**
+ * @file BinaryLogWriter.h
+ * @brief Writer of the binary columnar log
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "LogSchema.h"
+#include "LogSink.h"
+
+/**
+ * @class BinaryLogWriter
+ * @brief Writer of the binary columnar log
+ * @note File layout (little endian, all sections are aligned to 8 bytes):
+ *       - Header: magic "S2EBLOG\0", version (u32), number of fields (u32), number of columns (u64), the fields, and zero padding.
+ *         Each field is name, frame, unit (u32 length + characters), type, rows, cols, precision, number of columns (u32 each), and
+ *         the CSV column names.
+ *       - Chunks: magic "CHNK", number of rows (u32), first row (u64), and the values of each column (8 bytes each) in column order.
+ *       - Index: magic "INDX", reserved (u32), number of chunks (u64), and offset, first row, and number of rows (u64 each) of each chunk.
+ *       - Footer: offset of the index (u64) and magic "S2EBLEND".
+ *       The chunks can be read sequentially when the file is not closed normally and has no index.
+ */
+class BinaryLogWriter : public LogSink {
+ public:
+  /**
+   * @fn BinaryLogWriter
+   * @brief Constructor
+   * @param [in] output: Function to write the bytes to the file
+   * @param [in] rows_per_chunk: Number of rows in a chunk
+   */
+  BinaryLogWriter(const std::function<void(const std::string&)>& output, const size_t rows_per_chunk = 1024);
+
+  /**
+   * @fn Start
+   * @brief Write the header of the schema. The values are accepted after this call.
+   * @param [in] schema: Schema of the values
+   */
+  void Start(const LogSchema& schema);
+  /**
+   * @fn EndRow
+   * @brief Finish the values of a row. The lacking values are filled with zero, and the excess values are ignored.
+   */
+  void EndRow();
+  /**
+   * @fn Finish
+   * @brief Write the remaining rows, the index, and the footer
+   */
+  void Finish();
+
+  // Override LogSink
+  /**
+   * @fn AddDouble
+   * @brief Override AddDouble function of LogSink
+   */
+  virtual void AddDouble(const double value);
+  /**
+   * @fn AddInteger
+   * @brief Override AddInteger function of LogSink
+   */
+  virtual void AddInteger(const long long value);
+
+  static const char kMagic[8];         //!< Magic of the file header
+  static const char kFooterMagic[8];   //!< Magic of the file footer
+  static const uint32_t kVersion = 1;  //!< Format version
+
+ private:
+  /**
+   * @struct ChunkIndex
+   * @brief Position of a chunk
+   */
+  struct ChunkIndex {
+    uint64_t offset;     //!< Offset in the file [byte]
+    uint64_t first_row;  //!< First row
+    uint64_t num_rows;   //!< Number of rows
+  };
+
+  std::function<void(const std::string&)> output_;  //!< Output of the bytes
+  size_t rows_per_chunk_;                           //!< Number of rows in a chunk
+  std::vector<LogValueType> column_types_;          //!< Type of each column
+  std::vector<uint64_t> values_;                    //!< Values in the chunk (column major)
+  size_t num_rows_;                                 //!< Number of rows in the chunk
+  size_t column_;                                   //!< Column of the next value
+  uint64_t first_row_;                              //!< First row of the chunk
+  uint64_t offset_;                                 //!< Size of the written bytes
+  std::vector<ChunkIndex> chunk_index_;             //!< Index of the written chunks
+  std::string bytes_;                               //!< Work buffer of the output
+  bool is_started_;                                 //!< Is the header written?
+  bool is_finished_;                                //!< Is the footer written?
+
+  /**
+   * @fn SetValue
+   * @brief Set the raw value of the next column
+   */
+  void SetValue(const uint64_t raw);
+  /**
+   * @fn WriteChunk
+   * @brief Write the rows of the chunk
+   */
+  void WriteChunk();
+  /**
+   * @fn Output
+   * @brief Write the work buffer and clear it
+   */
+  void Output();
+};
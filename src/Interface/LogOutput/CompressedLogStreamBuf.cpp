@@ -0,0 +1,106 @@
+/**
+ * @file CompressedLogStreamBuf.cpp
+ * @brief Stream buffer to write the log file as independently compressed blocks
+ */
+
+#include "CompressedLogStreamBuf.h"
+
+#include <Library/utils/lz4_block.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+const char CompressedLogStreamBuf::kMagic[8] = {'S', '2', 'E', 'L', 'Z', '4', 'B', '\0'};
+const char CompressedLogStreamBuf::kFooterMagic[8] = {'S', '2', 'E', 'L', 'Z', 'E', 'N', 'D'};
+
+/**
+ * @fn AppendRaw
+ * @brief Append the bytes of the value in the host byte order (little endian on the supported platforms)
+ */
+template <typename T>
+static void AppendRaw(string& bytes, const T value) {
+  char raw[sizeof(T)];
+  memcpy(raw, &value, sizeof(T));
+  bytes.append(raw, sizeof(T));
+}
+
+CompressedLogStreamBuf::CompressedLogStreamBuf(ostream& file, const size_t block_size, const int level)
+    : file_(file), block_size_(min<size_t>(max<size_t>(block_size, kMinBlockSize), kMaxBlockSize)), level_(level), file_offset_(0), raw_offset_(0), is_finished_(false) {
+  block_.reserve(block_size_);
+  string header(kMagic, sizeof(kMagic));
+  AppendRaw(header, kVersion);
+  AppendRaw(header, (uint32_t)block_size_);
+  WriteToFile(header);
+}
+
+CompressedLogStreamBuf::~CompressedLogStreamBuf() { Finish(); }
+
+void CompressedLogStreamBuf::Finish() {
+  if (is_finished_) return;
+  is_finished_ = true;
+  if (!block_.empty()) WriteBlock();
+
+  const uint64_t index_offset = file_offset_;
+  string index("INDX", 4);
+  AppendRaw(index, (uint32_t)0);
+  AppendRaw(index, (uint64_t)index_.size());
+  for (const auto& entry : index_) {
+    AppendRaw(index, entry.first);
+    AppendRaw(index, entry.second);
+  }
+  AppendRaw(index, index_offset);
+  index.append(kFooterMagic, sizeof(kFooterMagic));
+  WriteToFile(index);
+  file_.flush();
+}
+
+streamsize CompressedLogStreamBuf::xsputn(const char* s, streamsize n) {
+  streamsize written = 0;
+  while (written < n) {
+    const size_t size = min<size_t>((size_t)(n - written), block_size_ - block_.size());
+    block_.append(s + written, size);
+    written += size;
+    if (block_.size() >= block_size_) WriteBlock();
+  }
+  return written;
+}
+
+CompressedLogStreamBuf::int_type CompressedLogStreamBuf::overflow(int_type c) {
+  if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+  const char ch = traits_type::to_char_type(c);
+  xsputn(&ch, 1);
+  return c;
+}
+
+int CompressedLogStreamBuf::sync() {
+  file_.flush();
+  return file_.good() ? 0 : -1;
+}
+
+void CompressedLogStreamBuf::WriteBlock() {
+  index_.emplace_back(file_offset_, raw_offset_);
+
+  compressed_.clear();
+  AppendRaw(compressed_, (uint32_t)0);
+  AppendRaw(compressed_, (uint32_t)block_.size());
+  const size_t compressed_size = compress_lz4_block(block_.data(), block_.size(), compressed_, level_);
+  uint32_t stored_size = (uint32_t)compressed_size;
+  if (compressed_size >= block_.size()) {
+    // Store the block as it is when it is not compressed
+    compressed_.resize(2 * sizeof(uint32_t));
+    compressed_.append(block_);
+    stored_size = (uint32_t)block_.size() | kStoredFlag;
+  }
+  memcpy(&compressed_[0], &stored_size, sizeof(stored_size));
+  WriteToFile(compressed_);
+
+  raw_offset_ += block_.size();
+  block_.clear();
+}
+
+void CompressedLogStreamBuf::WriteToFile(const string& bytes) {
+  file_.write(bytes.data(), bytes.size());
+  file_offset_ += bytes.size();
+}
@@ -0,0 +1,109 @@
+/**
+ * @file CompressedLogStreamBuf.h
+ * @brief Stream buffer to write the log file as independently compressed blocks
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class CompressedLogStreamBuf
+ * @brief Stream buffer to write the log file as independently compressed blocks
+ * @note The written bytes are cut into blocks of the same size, and each block is compressed in the LZ4 block format. Any block can be
+ *       decompressed without the others, so that the tools can seek the data with the index.
+ *       File layout (little endian):
+ *       - Header: magic "S2ELZ4B\0", version (u32), and size of the blocks before compression (u32).
+ *       - Blocks: stored size (u32, the most significant bit is set when the block is stored without compression), size before
+ *         compression (u32), and the stored bytes.
+ *       - Index: magic "INDX", reserved (u32), number of blocks (u64), and offset in the file (u64) and offset in the
+ *         decompressed data (u64) of each block.
+ *       - Footer: offset of the index (u64) and magic "S2ELZEND".
+ *       The blocks can be read sequentially when the file is not closed normally and has no index.
+ *       The compression runs on the thread which writes the stream, i.e., the writer thread when the asynchronous writer is used.
+ */
+class CompressedLogStreamBuf : public std::streambuf {
+ public:
+  /**
+   * @fn CompressedLogStreamBuf
+   * @brief Constructor. The header is written to the file.
+   * @param [in] file: Output file opened in the binary mode. The file must not be used by the others until this is finished.
+   * @param [in] block_size: Size of a block before compression [byte]
+   * @param [in] level: Compression level from 1 (fastest) to 9 (smallest)
+   */
+  CompressedLogStreamBuf(std::ostream& file, const size_t block_size, const int level);
+  /**
+   * @fn ~CompressedLogStreamBuf
+   * @brief Destructor. The file is finished when it is not finished yet.
+   */
+  ~CompressedLogStreamBuf();
+
+  /**
+   * @fn Finish
+   * @brief Compress the remaining bytes and write the index and the footer
+   */
+  void Finish();
+
+  /**
+   * @fn GetRawSize
+   * @brief Return the number of the bytes written to this buffer
+   */
+  inline uint64_t GetRawSize() const { return raw_offset_ + block_.size(); }
+  /**
+   * @fn GetFileSize
+   * @brief Return the number of the bytes written to the file
+   */
+  inline uint64_t GetFileSize() const { return file_offset_; }
+
+ protected:
+  // Override std::streambuf
+  /**
+   * @fn xsputn
+   * @brief Override xsputn function of std::streambuf
+   */
+  virtual std::streamsize xsputn(const char* s, std::streamsize n);
+  /**
+   * @fn overflow
+   * @brief Override overflow function of std::streambuf
+   */
+  virtual int_type overflow(int_type c);
+  /**
+   * @fn sync
+   * @brief Override sync function of std::streambuf. The file is flushed, but the current block is not cut.
+   */
+  virtual int sync();
+
+ private:
+  std::ostream& file_;                                //!< Output file
+  size_t block_size_;                                 //!< Size of a block before compression [byte]
+  int level_;                                         //!< Compression level
+  std::string block_;                                 //!< Bytes of the current block
+  std::string compressed_;                            //!< Buffer of the compressed block
+  std::vector<std::pair<uint64_t, uint64_t>> index_;  //!< Offsets in the file and in the decompressed data of the blocks
+  uint64_t file_offset_;                              //!< Size of the file [byte]
+  uint64_t raw_offset_;                               //!< Size of the compressed blocks before compression [byte]
+  bool is_finished_;                                  //!< Is the file finished?
+
+  static const uint32_t kVersion = 1;               //!< Version of the file format
+  static const uint32_t kStoredFlag = 0x80000000U;  //!< Flag of the block stored without compression
+  static const size_t kMinBlockSize = 1024;         //!< Minimum size of a block [byte]
+  static const size_t kMaxBlockSize = 64 << 20;     //!< Maximum size of a block [byte]
+  static const char kMagic[8];                      //!< Magic of the header
+  static const char kFooterMagic[8];                //!< Magic of the footer
+
+  /**
+   * @fn WriteBlock
+   * @brief Compress and write the current block
+   */
+  void WriteBlock();
+  /**
+   * @fn WriteToFile
+   * @brief Write the bytes to the file
+   */
+  void WriteToFile(const std::string& bytes);
+};
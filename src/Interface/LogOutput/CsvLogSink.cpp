@@ -0,0 +1,48 @@
+/**
+ * @file CsvLogSink.cpp
+ * @brief Output of the logged values as CSV text into a caller-provided buffer
+ */
+
+#include "CsvLogSink.h"
+
+#include <algorithm>
+#include <charconv>
+
+using namespace std;
+
+CsvLogSink::CsvLogSink(string& buffer) : buffer_(buffer), column_(0) {}
+
+CsvLogSink::CsvLogSink(string& buffer, const LogSchema& schema) : buffer_(buffer), column_(0) { SetSchema(schema); }
+
+void CsvLogSink::SetSchema(const LogSchema& schema) {
+  precisions_.resize(schema.GetNumOfColumns());
+  for (size_t column = 0; column < precisions_.size(); column++) precisions_[column] = schema.GetColumnPrecision(column);
+}
+
+void CsvLogSink::AddDouble(const double value) {
+  const int precision = column_ < precisions_.size() ? precisions_[column_] : kDefaultPrecision;
+  column_++;
+  // Same as std::setprecision with the default float field, which is %g of printf
+  char text[32];
+  to_chars_result result;
+  if (precision > 0) {
+    result = to_chars(text, text + sizeof(text), value, chars_format::general, precision);
+  } else {
+    result = to_chars(text, text + sizeof(text), value);
+  }
+  buffer_.append(text, result.ptr);
+  buffer_.push_back(',');
+}
+
+void CsvLogSink::AddInteger(const long long value) {
+  column_++;
+  char text[24];
+  const to_chars_result result = to_chars(text, text + sizeof(text), value);
+  buffer_.append(text, result.ptr);
+  buffer_.push_back(',');
+}
+
+void CsvLogSink::AddCsvValues(const string& values) {
+  column_ += count(values.begin(), values.end(), ',');
+  buffer_.append(values);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file CsvLogSink.h
+ * @brief Output of the logged values as CSV text into a caller-provided buffer
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "LogSchema.h"
+#include "LogSink.h"
+
+/**
+ * @class CsvLogSink
+ * @brief Output of the logged values as CSV text into a caller-provided buffer
+ * @note The values are converted with std::to_chars without temporary strings. The text is the same as the functions in LogUtility.h
+ *       with the precision of each column in the schema. The buffer keeps its capacity, so that no allocation happens after the
+ *       first lines.
+ */
+class CsvLogSink : public LogSink {
+ public:
+  /**
+   * @fn CsvLogSink
+   * @brief Constructor
+   * @param [out] buffer: Buffer to append the text
+   */
+  explicit CsvLogSink(std::string& buffer);
+  /**
+   * @fn CsvLogSink
+   * @brief Constructor
+   * @param [out] buffer: Buffer to append the text
+   * @param [in] schema: Schema of the values
+   */
+  CsvLogSink(std::string& buffer, const LogSchema& schema);
+
+  /**
+   * @fn SetSchema
+   * @brief Set the precision of each column from the schema
+   * @param [in] schema: Schema of the values
+   */
+  void SetSchema(const LogSchema& schema);
+  /**
+   * @fn BeginRow
+   * @brief Start a row from the first column. The buffer is not cleared.
+   */
+  inline void BeginRow() { column_ = 0; }
+
+  // Override LogSink
+  /**
+   * @fn AddDouble
+   * @brief Override AddDouble function of LogSink
+   */
+  virtual void AddDouble(const double value);
+  /**
+   * @fn AddInteger
+   * @brief Override AddInteger function of LogSink
+   */
+  virtual void AddInteger(const long long value);
+  /**
+   * @fn AddCsvValues
+   * @brief Override AddCsvValues function of LogSink. The text is appended as it is.
+   */
+  virtual void AddCsvValues(const std::string& values);
+
+ private:
+  std::string& buffer_;                    //!< Output buffer
+  std::vector<int> precisions_;            //!< Number of digits of each column
+  size_t column_;                          //!< Column of the next value
+  static const int kDefaultPrecision = 6;  //!< Precision of the columns not in the schema (same as LogUtility.h)
+};
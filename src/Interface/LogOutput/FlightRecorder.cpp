@@ -0,0 +1,67 @@
+/**
+ * @file FlightRecorder.cpp
+ * @brief Ring buffer of the latest logged values in memory
+ */
+
+#include "FlightRecorder.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+FlightRecorder::FlightRecorder(const size_t num_of_rows)
+    : num_of_rows_(max<size_t>(num_of_rows, 1)),
+      num_of_columns_(0),
+      next_row_(0),
+      num_of_recorded_rows_(0),
+      row_(nullptr),
+      column_(0),
+      is_nan_detected_(false) {}
+
+void FlightRecorder::SetSchema(const LogSchema& schema) {
+  schema_ = schema;
+  num_of_columns_ = schema.GetNumOfColumns();
+  ring_.assign(num_of_rows_ * num_of_columns_, 0.0);
+  next_row_ = 0;
+  num_of_recorded_rows_ = 0;
+}
+
+void FlightRecorder::BeginRow() {
+  row_ = ring_.data() + next_row_ * num_of_columns_;
+  column_ = 0;
+  is_nan_detected_ = false;
+}
+
+void FlightRecorder::EndRow() {
+  for (; column_ < num_of_columns_; column_++) row_[column_] = numeric_limits<double>::quiet_NaN();
+  next_row_ = (next_row_ + 1) % num_of_rows_;
+  if (num_of_recorded_rows_ < num_of_rows_) num_of_recorded_rows_++;
+}
+
+void FlightRecorder::AddDouble(const double value) {
+  if (std::isnan(value)) is_nan_detected_ = true;
+  // The values beyond the schema are ignored
+  if (column_ < num_of_columns_) row_[column_] = value;
+  column_++;
+}
+
+void FlightRecorder::AddInteger(const long long value) {
+  if (column_ < num_of_columns_) row_[column_] = (double)value;
+  column_++;
+}
+
+void FlightRecorder::Replay(LogSink& sink, const function<void()>& end_row) const {
+  const size_t oldest_row = (next_row_ + num_of_rows_ - num_of_recorded_rows_) % num_of_rows_;
+  for (size_t i = 0; i < num_of_recorded_rows_; i++) {
+    const double* row = ring_.data() + ((oldest_row + i) % num_of_rows_) * num_of_columns_;
+    for (size_t column = 0; column < num_of_columns_; column++) {
+      if (schema_.GetColumnType(column) == LogValueType::Int64 && !std::isnan(row[column])) {
+        sink.AddInteger((long long)row[column]);
+      } else {
+        sink.AddDouble(row[column]);
+      }
+    }
+    end_row();
+  }
+}
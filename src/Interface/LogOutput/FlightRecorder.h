@@ -0,0 +1,93 @@
+/**
+ * @file FlightRecorder.h
+ * @brief Ring buffer of the latest logged values in memory
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "LogSchema.h"
+#include "LogSink.h"
+
+/**
+ * @class FlightRecorder
+ * @brief Ring buffer of the latest logged values in memory
+ * @note The values are stored as raw doubles in a buffer allocated once for the schema, so that recording a row costs neither
+ *       formatting nor allocation. Integer values are stored exactly up to 2^53. The rows are converted to a file only when
+ *       they are replayed into another sink (e.g., CsvLogSink or BinaryLogWriter).
+ */
+class FlightRecorder : public LogSink {
+ public:
+  /**
+   * @fn FlightRecorder
+   * @brief Constructor
+   * @param [in] num_of_rows: Number of the latest rows to keep
+   */
+  explicit FlightRecorder(const size_t num_of_rows);
+
+  /**
+   * @fn SetSchema
+   * @brief Set the schema of the rows and clear the recorded rows
+   * @param [in] schema: Schema of the values
+   */
+  void SetSchema(const LogSchema& schema);
+  /**
+   * @fn BeginRow
+   * @brief Start recording a row. The oldest row is overwritten when the ring is full.
+   */
+  void BeginRow();
+  /**
+   * @fn EndRow
+   * @brief Finish recording the row. The columns which are not added are filled with NaN.
+   */
+  void EndRow();
+
+  /**
+   * @fn Replay
+   * @brief Add the recorded rows from the oldest to the sink with the types in the schema
+   * @param [out] sink: Output of the values
+   * @param [in] end_row: Function called at the end of each row
+   */
+  void Replay(LogSink& sink, const std::function<void()>& end_row) const;
+
+  /**
+   * @fn GetSchema
+   * @brief Return the schema of the rows
+   */
+  inline const LogSchema& GetSchema() const { return schema_; }
+  /**
+   * @fn GetNumOfRecordedRows
+   * @brief Return the number of the rows in the ring
+   */
+  inline size_t GetNumOfRecordedRows() const { return num_of_recorded_rows_; }
+  /**
+   * @fn IsNanDetected
+   * @brief Return true when NaN was added in the last row
+   */
+  inline bool IsNanDetected() const { return is_nan_detected_; }
+
+  // Override LogSink
+  /**
+   * @fn AddDouble
+   * @brief Override AddDouble function of LogSink
+   */
+  virtual void AddDouble(const double value);
+  /**
+   * @fn AddInteger
+   * @brief Override AddInteger function of LogSink
+   */
+  virtual void AddInteger(const long long value);
+
+ private:
+  LogSchema schema_;             //!< Schema of the rows
+  size_t num_of_rows_;           //!< Capacity of the ring [rows]
+  size_t num_of_columns_;        //!< Number of the columns of a row
+  std::vector<double> ring_;     //!< Recorded values (row-major)
+  size_t next_row_;              //!< Index of the row to record next
+  size_t num_of_recorded_rows_;  //!< Number of the rows in the ring
+  double* row_;                  //!< First value of the row being recorded
+  size_t column_;                //!< Column of the next value
+  bool is_nan_detected_;         //!< Is NaN added in the row
+};
@@ -4,8 +4,12 @@
  */
 
 #pragma once
+#include <stdexcept>
 #include <string>
 
+#include "CsvLogSink.h"
+#include "LogSchema.h"
+#include "LogSink.h"
 #include "LogUtility.h"  // This is not necessary but include here for convenience
 
 /**
@@ -15,19 +19,85 @@
  */
 class ILoggable {
  public:
+  /**
+   * @fn GetLogSchema
+   * @brief Add the typed description of the values to the schema
+   * @note Override either the pair of GetLogSchema and LogValues or the pair of GetLogHeader and GetLogValue. The default
+   *       implementations of each pair are the adapters of the other pair, and they throw std::logic_error when neither is overridden.
+   * @param [out] schema: Schema
+   */
+  virtual void GetLogSchema(LogSchema& schema) const {
+    AdapterGuard guard(header_adapter_owner_, this);
+    schema.AddColumns(GetLogHeader());
+  }
+
+  /**
+   * @fn LogValues
+   * @brief Write the values to the sink in the order of the schema
+   * @param [out] sink: Output of the values
+   */
+  virtual void LogValues(LogSink& sink) const {
+    AdapterGuard guard(value_adapter_owner_, this);
+    sink.AddCsvValues(GetLogValue());
+  }
+
   /**
    * @fn GetLogHeader
    * @brief Get headers to write in CSV output file
    * @return The headers
    */
-  virtual std::string GetLogHeader() const = 0;
+  virtual std::string GetLogHeader() const {
+    AdapterGuard guard(header_adapter_owner_, this);
+    LogSchema schema;
+    GetLogSchema(schema);
+    return schema.GetCsvHeader();
+  }
 
   /**
    * @fn GetLogValue
    * @brief Get values to write in CSV output file
    * @return The output values
    */
-  virtual std::string GetLogValue() const = 0;
+  virtual std::string GetLogValue() const {
+    AdapterGuard guard(value_adapter_owner_, this);
+    LogSchema schema;
+    GetLogSchema(schema);
+    std::string values;
+    CsvLogSink sink(values, schema);
+    LogValues(sink);
+    return values;
+  }
 
   bool IsLogEnabled = true;  //!< Log enable flag
+
+ private:
+  /**
+   * @struct AdapterGuard
+   * @brief Detect that the default adapters of a pair call each other for the same object, which means neither is overridden
+   */
+  struct AdapterGuard {
+    /**
+     * @fn AdapterGuard
+     * @brief Mark the object as running the adapter. Throw std::logic_error when the object is already running the other adapter.
+     * @param [in,out] owner: Object running the adapter of the pair on this thread
+     * @param [in] object: Object calling the adapter
+     */
+    AdapterGuard(const ILoggable*& owner, const ILoggable* object) : owner_(owner), previous_(owner) {
+      if (owner == object) {
+        throw std::logic_error("ILoggable: override GetLogSchema and LogValues, or GetLogHeader and GetLogValue");
+      }
+      owner_ = object;
+    }
+    /**
+     * @fn ~AdapterGuard
+     * @brief Restore the previous object
+     */
+    ~AdapterGuard() { owner_ = previous_; }
+
+    const ILoggable*& owner_;    //!< Object running the adapter of the pair on this thread
+    const ILoggable* previous_;  //!< Object running the adapter before this guard
+  };
+
+  static inline thread_local const ILoggable* header_adapter_owner_ = nullptr;  //!< Object running GetLogSchema or GetLogHeader adapter
+  static inline thread_local const ILoggable* value_adapter_owner_ = nullptr;   //!< Object running LogValues or GetLogValue adapter
 };
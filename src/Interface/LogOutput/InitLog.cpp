@@ -7,17 +7,61 @@
 
 #include <Interface/InitInput/IniAccess.h>
 
+#include <cmath>
+
 Logger* InitLog(std::string file_name) {
   IniAccess ini_file(file_name);
 
   std::string log_file_path = ini_file.ReadString("SIM_SETTING", "log_file_path");
   bool log_ini = ini_file.ReadBoolean("SIM_SETTING", "log_inifile");
 
-  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true);
+  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true, InitLogFormat(file_name));
+  InitLogSettings(*log, file_name);
 
   return log;
 }
 
+LogFormat InitLogFormat(std::string file_name) {
+  IniAccess ini_file(file_name);
+  return ini_file.ReadString("SIM_SETTING", "log_format") == "BINARY" ? LogFormat::Binary : LogFormat::Csv;
+}
+
+void InitLogSettings(Logger& logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "SIM_SETTING";
+
+  if (ini_file.ReadEnable(section, "log_compression")) {
+    logger.EnableCompression(ini_file.ReadInt(section, "log_compression_level"),
+                             (size_t)ini_file.ReadInt(section, "log_compression_block_size_kib") * 1024);
+  }
+  if (ini_file.ReadEnable(section, "log_async_writing")) {
+    logger.EnableAsyncWriting(ini_file.ReadInt(section, "log_async_num_of_buffers"));
+  }
+  InitLogChannels(logger, file_name);
+  InitFlightRecorder(logger, file_name);
+}
+
+void InitLogChannels(Logger& logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "LOG_CHANNEL";
+
+  std::vector<std::string> channels = ini_file.ReadStrVector(section, "channel_name");
+  for (size_t i = 0; i < channels.size(); i++) {
+    const std::string key = "output_interval_sec(" + std::to_string(i) + ")";
+    logger.SetChannelInterval(channels[i], ini_file.ReadDouble(section, key.c_str()));
+  }
+}
+
+void InitFlightRecorder(Logger& logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  if (!ini_file.ReadEnable("SIM_SETTING", "flight_recorder")) return;
+  const double duration_sec = ini_file.ReadDouble("SIM_SETTING", "flight_recorder_duration_sec");
+  const double log_output_interval_sec = ini_file.ReadDouble("TIME", "LogOutPutIntervalSec");
+  const size_t num_of_rows = log_output_interval_sec > 0.0 ? (size_t)std::ceil(duration_sec / log_output_interval_sec) + 1 : 1;
+  logger.EnableFlightRecorder(num_of_rows, ini_file.ReadEnable("SIM_SETTING", "flight_recorder_dump_on_nan"));
+}
+
 Logger* InitLogMC(std::string file_name, bool enable) {
   IniAccess ini_file(file_name);
 
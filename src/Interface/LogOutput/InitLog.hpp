@@ -14,6 +14,38 @@
  */
 Logger* InitLog(std::string file_name);
 
+/**
+ * @fn InitLogFormat
+ * @brief Read the format of the log file written in the [SIM_SETTING] section
+ * @param [in] file_name: Path to the initialize file
+ */
+LogFormat InitLogFormat(std::string file_name);
+
+/**
+ * @fn InitLogSettings
+ * @brief Set the compression, the asynchronous writing, the log channels, and the flight recorder of the logger
+ * @note This is shared by the loggers of the normal simulation and the Monte-Carlo simulation cases
+ * @param [in] logger: Logger
+ * @param [in] file_name: Path to the initialize file
+ */
+void InitLogSettings(Logger& logger, std::string file_name);
+
+/**
+ * @fn InitLogChannels
+ * @brief Set the output intervals of the log channels written in the [LOG_CHANNEL] section
+ * @param [in] logger: Logger
+ * @param [in] file_name: Path to the initialize file
+ */
+void InitLogChannels(Logger& logger, std::string file_name);
+
+/**
+ * @fn InitFlightRecorder
+ * @brief Enable the flight recorder of the logger when it is enabled in the [SIM_SETTING] section
+ * @param [in] logger: Logger
+ * @param [in] file_name: Path to the initialize file
+ */
+void InitFlightRecorder(Logger& logger, std::string file_name);
+
 /**
  * @fn InitLogMC
  * @brief Initialize logger for Monte-Carlo simulation (mont.csv)
@@ -0,0 +1,63 @@
+/**
+ * @file LogSchema.cpp
+ * @brief Typed description of the logged values
+ */
+
+#include "LogSchema.h"
+
+#include "LogUtility.h"
+
+using namespace std;
+
+void LogSchema::AddScalar(const string& name, const string& unit, const int precision, const LogValueType type) {
+  AddField(LogField{name, "", unit, type, 1, 1, precision, {}}, WriteScalar(name, unit));
+}
+
+void LogSchema::AddColumn(const string& column_name, const int precision, const LogValueType type) {
+  AddField(LogField{column_name, "", "", type, 1, 1, precision, {}}, column_name + ",");
+}
+
+void LogSchema::AddVector(const string& name, const string& frame, const string& unit, const size_t n, const int precision) {
+  AddField(LogField{name, frame, unit, LogValueType::Double, n, 1, precision, {}}, WriteVector(name, frame, unit, n));
+}
+
+void LogSchema::AddMatrix(const string& name, const string& frame, const string& unit, const size_t r, const size_t c) {
+  AddField(LogField{name, frame, unit, LogValueType::Double, r, c, 6, {}}, WriteMatrix(name, frame, unit, r, c));
+}
+
+void LogSchema::AddColumns(const string& csv_header) {
+  size_t begin = 0;
+  size_t end;
+  while ((end = csv_header.find(',', begin)) != string::npos) {
+    const string column = csv_header.substr(begin, end - begin);
+    begin = end + 1;
+    // name[unit]
+    string unit;
+    const size_t unit_begin = column.rfind('[');
+    if (unit_begin != string::npos && column.back() == ']') unit = column.substr(unit_begin + 1, column.size() - unit_begin - 2);
+    // The precision of the original text is unknown
+    AddField(LogField{column, "", unit, LogValueType::Double, 1, 1, 0, {}}, column + ",");
+  }
+}
+
+string LogSchema::GetCsvHeader() const {
+  string header;
+  for (const auto& field : fields_) {
+    for (const auto& column_name : field.column_names) header += column_name + ",";
+  }
+  return header;
+}
+
+void LogSchema::AddField(LogField field, const string& csv_header) {
+  size_t begin = 0;
+  size_t end;
+  while ((end = csv_header.find(',', begin)) != string::npos) {
+    field.column_names.push_back(csv_header.substr(begin, end - begin));
+    begin = end + 1;
+  }
+  for (size_t i = 0; i < field.column_names.size(); i++) {
+    column_types_.push_back(field.type);
+    column_precisions_.push_back(field.precision);
+  }
+  fields_.push_back(move(field));
+}
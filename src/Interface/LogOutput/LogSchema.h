@@ -0,0 +1,128 @@
+/**
+ * @file LogSchema.h
+ * @brief Typed description of the logged values
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @enum LogValueType
+ * @brief Type of the logged value
+ */
+enum class LogValueType {
+  Double,  //!< 64bit floating point
+  Int64,   //!< 64bit signed integer
+};
+
+/**
+ * @struct LogField
+ * @brief Logged scalar, vector, or matrix value
+ */
+struct LogField {
+  std::string name;                       //!< Name
+  std::string frame;                      //!< Frame (empty for scalar)
+  std::string unit;                       //!< Unit
+  LogValueType type;                      //!< Type of the elements
+  size_t rows;                            //!< Number of rows
+  size_t cols;                            //!< Number of columns
+  int precision;                          //!< Number of digits in the text output (0: the shortest digits to restore the value)
+  std::vector<std::string> column_names;  //!< Header of each element in the CSV output
+};
+
+/**
+ * @class LogSchema
+ * @brief Typed description of the logged values
+ * @note The fields are added in the order of the values written to LogSink. The column names are the same as the headers made with
+ *       the functions in LogUtility.h.
+ */
+class LogSchema {
+ public:
+  /**
+   * @fn AddScalar
+   * @brief Add a scalar value
+   * @param [in] name: Name of the value
+   * @param [in] unit: Unit of the value
+   * @param [in] precision: Number of digits in the text output
+   * @param [in] type: Type of the value
+   */
+  void AddScalar(const std::string& name, const std::string& unit, const int precision = 6, const LogValueType type = LogValueType::Double);
+  /**
+   * @fn AddColumn
+   * @brief Add a scalar value whose CSV header is the name without unit
+   * @param [in] column_name: CSV header of the value
+   * @param [in] precision: Number of digits in the text output
+   * @param [in] type: Type of the value
+   */
+  void AddColumn(const std::string& column_name, const int precision = 6, const LogValueType type = LogValueType::Double);
+  /**
+   * @fn AddVector
+   * @brief Add a vector value
+   * @param [in] name: Name of the value
+   * @param [in] frame: Frame of the value
+   * @param [in] unit: Unit of the value
+   * @param [in] n: Number of elements
+   * @param [in] precision: Number of digits in the text output
+   */
+  void AddVector(const std::string& name, const std::string& frame, const std::string& unit, const size_t n, const int precision = 6);
+  /**
+   * @fn AddMatrix
+   * @brief Add a matrix value
+   * @param [in] name: Name of the value
+   * @param [in] frame: Frame of the value
+   * @param [in] unit: Unit of the value
+   * @param [in] r: Row length
+   * @param [in] c: Column length
+   */
+  void AddMatrix(const std::string& name, const std::string& frame, const std::string& unit, const size_t r, const size_t c);
+  /**
+   * @fn AddColumns
+   * @brief Add the columns of the CSV header as double scalars. This is used for the loggables without typed description.
+   * @param [in] csv_header: CSV header made with GetLogHeader
+   */
+  void AddColumns(const std::string& csv_header);
+
+  /**
+   * @fn GetFields
+   * @brief Return the fields
+   */
+  inline const std::vector<LogField>& GetFields() const { return fields_; }
+  /**
+   * @fn GetNumOfColumns
+   * @brief Return the total number of the elements of all fields
+   */
+  inline size_t GetNumOfColumns() const { return column_types_.size(); }
+  /**
+   * @fn GetColumnType
+   * @brief Return the type of the column
+   * @param [in] column: Index of the column
+   */
+  inline LogValueType GetColumnType(const size_t column) const { return column_types_[column]; }
+  /**
+   * @fn GetColumnPrecision
+   * @brief Return the number of digits in the text output of the column
+   * @param [in] column: Index of the column
+   */
+  inline int GetColumnPrecision(const size_t column) const { return column_precisions_[column]; }
+  /**
+   * @fn GetCsvHeader
+   * @brief Return the header of the CSV output
+   */
+  std::string GetCsvHeader() const;
+
+ private:
+  std::vector<LogField> fields_;            //!< Fields
+  std::vector<LogValueType> column_types_;  //!< Type of each column
+  std::vector<int> column_precisions_;      //!< Number of digits in the text output of each column
+
+  /**
+   * @fn AddField
+   * @brief Add the field and its columns
+   * @param [in] field: Field. The column names are made from the CSV header.
+   * @param [in] csv_header: CSV header of the field
+   */
+  void AddField(LogField field, const std::string& csv_header);
+};
@@ -0,0 +1,101 @@
+/**
+ * @file LogSink.h
+ * @brief Abstract output of the logged values without text conversion
+ */
+
+#pragma once
+
+#include <Library/math/MatVec.hpp>
+#include <Library/math/Quaternion.hpp>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+/**
+ * @class LogSink
+ * @brief Abstract output of the logged values without text conversion
+ * @note The values are written in the order of the fields in LogSchema.
+ */
+class LogSink {
+ public:
+  /**
+   * @fn ~LogSink
+   * @brief Destructor
+   */
+  virtual ~LogSink() {}
+
+  /**
+   * @fn AddDouble
+   * @brief Write a floating point value
+   * @param [in] value: Value
+   */
+  virtual void AddDouble(const double value) = 0;
+  /**
+   * @fn AddInteger
+   * @brief Write an integer value
+   * @param [in] value: Value
+   */
+  virtual void AddInteger(const long long value) = 0;
+  /**
+   * @fn AddCsvValues
+   * @brief Write the values in the CSV text. This is used for the loggables which make the text by themselves.
+   * @note The default implementation parses the text. Non-numerical values are written as NaN.
+   * @param [in] values: Comma separated values with the trailing comma
+   */
+  virtual void AddCsvValues(const std::string& values) {
+    size_t begin = 0;
+    size_t end;
+    while ((end = values.find(',', begin)) != std::string::npos) {
+      const char* head = values.c_str() + begin;
+      char* tail;
+      const double value = std::strtod(head, &tail);
+      AddDouble(tail == head ? std::numeric_limits<double>::quiet_NaN() : value);
+      begin = end + 1;
+    }
+  }
+
+  /**
+   * @fn Add
+   * @brief Write a floating point value
+   * @param [in] value: Value
+   */
+  inline void Add(const double value) { AddDouble(value); }
+  /**
+   * @fn Add
+   * @brief Write an integer or boolean value
+   * @param [in] value: Value
+   */
+  template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+  inline void Add(const T value) {
+    AddInteger((long long)value);
+  }
+  /**
+   * @fn Add
+   * @brief Write the elements of a vector
+   * @param [in] vec: Vector
+   */
+  template <size_t NUM>
+  inline void Add(const libra::Vector<NUM, double>& vec) {
+    for (size_t i = 0; i < NUM; i++) AddDouble(vec[i]);
+  }
+  /**
+   * @fn Add
+   * @brief Write the elements of a matrix in row major order
+   * @param [in] mat: Matrix
+   */
+  template <size_t ROW, size_t COLUMN>
+  inline void Add(const libra::Matrix<ROW, COLUMN, double>& mat) {
+    for (size_t i = 0; i < ROW; i++) {
+      for (size_t j = 0; j < COLUMN; j++) AddDouble(mat[i][j]);
+    }
+  }
+  /**
+   * @fn Add
+   * @brief Write the elements of a quaternion
+   * @param [in] quat: Quaternion
+   */
+  inline void Add(const libra::Quaternion& quat) {
+    for (size_t i = 0; i < 4; i++) AddDouble(quat[i]);
+  }
+};
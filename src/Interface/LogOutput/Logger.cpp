@@ -5,6 +5,9 @@
 
 #include "Logger.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <ctime>
 #include <sstream>
 #ifdef _WIN32
@@ -13,19 +16,47 @@
 #include <sys/stat.h>
 #endif
 
-std::vector<ILoggable *> loggables_;
+/**
+ * @class ChannelTime
+ * @brief Time column of the log file of a channel
+ */
+class ChannelTime : public ILoggable {
+ public:
+  double elapsed_time_sec = 0.0;  //!< Elapsed time of the simulation [sec]
+
+  void GetLogSchema(LogSchema &schema) const override { schema.AddScalar("time", "sec"); }
+  void LogValues(LogSink &sink) const override { sink.Add(elapsed_time_sec); }
+};
+
+/**
+ * @struct Logger::LogChannel
+ * @brief Loggables written in their own file at their own interval
+ */
+struct Logger::LogChannel {
+  std::string name;                //!< Name of the channel
+  double interval_sec = 0.0;       //!< Output interval [sec]
+  int64_t next_output_ticks = 0;   //!< Next output time [tick]
+  ChannelTime time;                //!< Time column
+  std::unique_ptr<Logger> logger;  //!< Logger of the file of the channel (nullptr until a loggable is added)
+};
 
-Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable) {
+Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable,
+               const LogFormat format) {
   is_enabled_ = enable;
   is_open_ = false;
   is_enabled_inilog_ = enable_inilog;
 
   // Get current time to append it to the filename
   time_t timer = time(NULL);
-  struct tm *now;
-  now = localtime(&timer);
+  struct tm now;
+  // Use the reentrant version since loggers are created from parallel cases
+#ifdef WIN32
+  localtime_s(&now, &timer);
+#else
+  localtime_r(&timer, &now);
+#endif
   char start_time_c[64];
-  strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
+  strftime(start_time_c, 64, "%y%m%d_%H%M%S", &now);
 
   // Create directory
   if (is_enabled_inilog_ == true)
@@ -34,51 +65,294 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
     directory_path_ = data_path;
   // Create File
   std::stringstream file_path;
-  file_path << directory_path_ << start_time_c << "_" << file_name;
-  if (is_enabled_) {
-    csv_file_.open(file_path.str());
-    is_open_ = csv_file_.is_open();
-    if (!is_open_) std::cerr << "Error opening log file: " << file_path.str() << std::endl;
+  file_path << directory_path_ << start_time_c << "_";
+  if (format == LogFormat::Binary) {
+    file_path << file_name.substr(0, file_name.rfind('.')) << ".bin";
+  } else {
+    file_path << file_name;
   }
+  format_ = format;
+  OpenFile(file_path.str());
   registered_num_ = 0;
 
   // Copy SimBase.ini
   CopyFileToLogDir(ini_file_name);
 }
 
+Logger::Logger(const std::string &file_path, const bool enable, const LogFormat format) {
+  is_enabled_ = enable;
+  is_open_ = false;
+  is_enabled_inilog_ = false;
+  format_ = format;
+  OpenFile(file_path);
+  registered_num_ = 0;
+}
+
 Logger::~Logger(void) {
+  // Close the files of the channels
+  channels_.clear();
+  // Write the remaining lines before closing the file
+  if (binary_writer_) binary_writer_->Finish();
+  async_writer_.reset();
+  if (compression_buf_) compression_buf_->Finish();
   if (is_open_) {
     csv_file_.close();
   }
 }
 
+void Logger::OpenFile(const std::string &file_path) {
+  file_path_ = file_path;
+  if (!is_enabled_) return;
+  if (format_ == LogFormat::Binary) {
+    csv_file_.open(file_path_, std::ios::out | std::ios::binary);
+    binary_writer_.reset(new BinaryLogWriter([this](const std::string &data) { WriteToFile(data); }));
+  } else {
+    csv_file_.open(file_path_);
+  }
+  is_open_ = csv_file_.is_open();
+  if (!is_open_) std::cerr << "Error opening log file: " << file_path_ << std::endl;
+}
+
 void Logger::WriteHeaders(bool add_newline) {
+  for (auto &channel : channels_) {
+    if (channel->logger) channel->logger->WriteHeaders(add_newline);
+  }
+  LogSchema schema;
+  for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
+    if (!((*itr)->IsLogEnabled)) continue;
+    (*itr)->GetLogSchema(schema);
+  }
+  if (flight_recorder_) flight_recorder_->SetSchema(schema);
+  if (binary_writer_) {
+    binary_writer_->Start(schema);
+    return;
+  }
   for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
     if (!((*itr)->IsLogEnabled)) continue;
     Write((*itr)->GetLogHeader());
   }
+  csv_sink_.SetSchema(schema);
+  if (async_writer_) async_writer_->SetSchema(schema);
   if (add_newline) WriteNewLine();
 }
 
 void Logger::WriteValues(bool add_newline) {
+  if (flight_recorder_) RecordFlightRecorder();
+  if (binary_writer_) {
+    if (!is_enabled_) return;
+    for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
+      if (!((*itr)->IsLogEnabled)) continue;
+      (*itr)->LogValues(*binary_writer_);
+    }
+    binary_writer_->EndRow();
+    return;
+  }
+  if (!is_enabled_) return;
+  if (async_writer_) {
+    // The raw values are passed and converted to the text on the writer thread
+    async_writer_->BeginRow();
+    for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
+      if (!((*itr)->IsLogEnabled)) continue;
+      (*itr)->LogValues(*async_writer_);
+    }
+    if (add_newline) WriteNewLine();
+    return;
+  }
+  // The values are converted into the reused buffer without temporary strings
+  line_buffer_.clear();
+  csv_sink_.BeginRow();
   for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
     if (!((*itr)->IsLogEnabled)) continue;
-    Write((*itr)->GetLogValue());
+    (*itr)->LogValues(csv_sink_);
   }
+  WriteToFile(line_buffer_);
   if (add_newline) WriteNewLine();
 }
 
-void Logger::WriteNewLine() { Write("\n"); }
+void Logger::RecordFlightRecorder() {
+  flight_recorder_->BeginRow();
+  for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
+    if (!((*itr)->IsLogEnabled)) continue;
+    (*itr)->LogValues(*flight_recorder_);
+  }
+  flight_recorder_->EndRow();
+
+  if (is_dump_on_nan_enabled_ && !is_nan_dumped_ && flight_recorder_->IsNanDetected()) {
+    is_nan_dumped_ = true;
+    TriggerFlightRecorder("NaN is logged");
+  }
+  if (flight_recorder_trigger_) {
+    const bool trigger_state = flight_recorder_trigger_();
+    if (trigger_state && !last_trigger_state_) TriggerFlightRecorder(flight_recorder_trigger_reason_);
+    last_trigger_state_ = trigger_state;
+  }
+}
+
+void Logger::EnableFlightRecorder(const size_t num_of_rows, const bool dump_on_nan) {
+  flight_recorder_.reset(new FlightRecorder(num_of_rows));
+  is_dump_on_nan_enabled_ = dump_on_nan;
+}
+
+void Logger::SetFlightRecorderTrigger(const std::function<bool()> &trigger, const std::string &reason) {
+  flight_recorder_trigger_ = trigger;
+  flight_recorder_trigger_reason_ = reason;
+  last_trigger_state_ = false;
+}
+
+void Logger::TriggerFlightRecorder(const std::string &reason) {
+  if (!flight_recorder_) return;
+
+  // e.g., 220101_120000_default.csv -> 220101_120000_default_flight_record0.csv
+  const size_t extension_pos = file_path_.rfind('.');
+  const std::string record_file_path =
+      file_path_.substr(0, extension_pos) + "_flight_record" + std::to_string(num_of_flight_records_) + file_path_.substr(extension_pos);
+  num_of_flight_records_++;
+
+  const LogSchema &schema = flight_recorder_->GetSchema();
+  std::ofstream record_file;
+  if (format_ == LogFormat::Binary) {
+    record_file.open(record_file_path, std::ios::out | std::ios::binary);
+  } else {
+    record_file.open(record_file_path);
+  }
+  if (!record_file.is_open()) {
+    std::cerr << "Error opening flight record file: " << record_file_path << std::endl;
+    return;
+  }
+  if (format_ == LogFormat::Binary) {
+    BinaryLogWriter writer([&record_file](const std::string &data) { record_file.write(data.data(), data.size()); });
+    writer.Start(schema);
+    flight_recorder_->Replay(writer, [&writer]() { writer.EndRow(); });
+    writer.Finish();
+  } else {
+    record_file << schema.GetCsvHeader() << "\n";
+    std::string line;
+    CsvLogSink sink(line, schema);
+    flight_recorder_->Replay(sink, [&]() {
+      line.push_back('\n');
+      record_file.write(line.data(), line.size());
+      line.clear();
+      sink.BeginRow();
+    });
+  }
+  std::cout << "Flight recorder (" << reason << "): " << flight_recorder_->GetNumOfRecordedRows() << " rows are written to " << record_file_path
+            << std::endl;
+}
+
+void Logger::WriteChannelValues(const int64_t elapsed_ticks, const int64_t ticks_per_sec) {
+  for (auto &channel : channels_) {
+    if (!channel->logger) continue;
+    if (elapsed_ticks < channel->next_output_ticks) continue;
+    channel->time.elapsed_time_sec = (double)elapsed_ticks / ticks_per_sec;
+    channel->logger->WriteValues();
+    // The next multiple of the interval. The output times passed in a step longer than the interval are skipped.
+    const int64_t interval_ticks = std::max<int64_t>(std::llround(channel->interval_sec * ticks_per_sec), 1);
+    channel->next_output_ticks = (elapsed_ticks / interval_ticks + 1) * interval_ticks;
+  }
+}
+
+void Logger::WriteNewLine() {
+  if (binary_writer_) return;
+  Write("\n");
+  if (async_writer_) async_writer_->EndLine();
+}
 
 void Logger::Write(std::string log, bool flag) {
-  if (flag && is_enabled_) {
-    csv_file_ << log;
+  if (flag && is_enabled_ && !binary_writer_) WriteToFile(log);
+}
+
+void Logger::WriteToFile(const std::string &data) {
+  if (async_writer_) {
+    async_writer_->Append(data);
+    // A binary chunk is passed as a line
+    if (binary_writer_) async_writer_->EndLine();
+  } else {
+    output_stream_->write(data.data(), data.size());
   }
 }
 
+void Logger::EnableAsyncWriting(const size_t num_of_buffers) {
+  num_of_async_buffers_ = num_of_buffers;
+  for (auto &channel : channels_) {
+    if (channel->logger) channel->logger->EnableAsyncWriting(num_of_buffers);
+  }
+  if (!is_open_ || async_writer_) return;
+  async_writer_.reset(new AsyncLogWriter(*output_stream_, num_of_buffers));
+}
+
+void Logger::EnableCompression(const int level, const size_t block_size) {
+  compression_level_ = level;
+  compression_block_size_ = block_size;
+  for (auto &channel : channels_) {
+    if (channel->logger) channel->logger->EnableCompression(level, block_size);
+  }
+  if (!is_open_ || compression_buf_) return;
+
+  // Reopen the file with the extension of the compressed file. The writer thread is made again for the new stream.
+  const bool is_async = (bool)async_writer_;
+  async_writer_.reset();
+  csv_file_.close();
+  std::remove(file_path_.c_str());
+  const std::string compressed_file_path = file_path_ + ".lz4b";
+  csv_file_.open(compressed_file_path, std::ios::out | std::ios::binary);
+  is_open_ = csv_file_.is_open();
+  if (!is_open_) {
+    std::cerr << "Error opening log file: " << compressed_file_path << std::endl;
+    return;
+  }
+  compression_buf_.reset(new CompressedLogStreamBuf(csv_file_, block_size, level));
+  compressed_stream_.reset(new std::ostream(compression_buf_.get()));
+  output_stream_ = compressed_stream_.get();
+  if (is_async) async_writer_.reset(new AsyncLogWriter(*output_stream_, num_of_async_buffers_));
+}
+
+void Logger::SetChannelInterval(const std::string &channel, const double interval_sec) {
+  if (interval_sec <= 0.0) return;
+  LogChannel *log_channel = FindChannel(channel);
+  if (log_channel == nullptr) {
+    channels_.emplace_back(new LogChannel());
+    log_channel = channels_.back().get();
+    log_channel->name = channel;
+  }
+  log_channel->interval_sec = interval_sec;
+}
+
 void Logger::AddLoggable(ILoggable *loggable) { loggables_.push_back(loggable); }
 
-void Logger::ClearLoggables() { loggables_.clear(); }
+void Logger::AddLoggable(ILoggable *loggable, const std::string &channel) {
+  LogChannel *log_channel = FindChannel(channel);
+  if (log_channel == nullptr) {
+    AddLoggable(loggable);
+    return;
+  }
+  if (!log_channel->logger) {
+    // The file is made when the first loggable is added to avoid empty files
+    // e.g., 220101_120000_default.csv -> 220101_120000_default_attitude.csv
+    const size_t extension_pos = file_path_.rfind('.');
+    const std::string channel_file_path = file_path_.substr(0, extension_pos) + "_" + channel + file_path_.substr(extension_pos);
+    log_channel->logger.reset(new Logger(channel_file_path, is_enabled_, format_));
+    if (compression_level_ > 0) log_channel->logger->EnableCompression(compression_level_, compression_block_size_);
+    if (num_of_async_buffers_ > 0) log_channel->logger->EnableAsyncWriting(num_of_async_buffers_);
+    log_channel->logger->AddLoggable(&log_channel->time);
+  }
+  log_channel->logger->AddLoggable(loggable);
+}
+
+void Logger::ClearLoggables() {
+  loggables_.clear();
+  for (auto &channel : channels_) {
+    if (!channel->logger) continue;
+    channel->logger->ClearLoggables();
+    channel->logger->AddLoggable(&channel->time);
+  }
+}
+
+Logger::LogChannel *Logger::FindChannel(const std::string &channel) {
+  for (auto &log_channel : channels_) {
+    if (log_channel->name == channel) return log_channel.get();
+  }
+  return nullptr;
+}
 
 std::string Logger::CreateDirectory(const std::string &data_path, const std::string &time) {
   std::string directory_path_tmp_ = data_path + "/logs_" + time + "/";
@@ -7,12 +7,29 @@
 #define __LOGGER_H__
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <cstdint>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "AsyncLogWriter.h"
+#include "BinaryLogWriter.h"
+#include "CompressedLogStreamBuf.h"
+#include "CsvLogSink.h"
+#include "FlightRecorder.h"
 #include "ILoggable.h"
 
+/**
+ * @enum LogFormat
+ * @brief Format of the log file
+ */
+enum class LogFormat {
+  Csv,     //!< Text with comma separated values
+  Binary,  //!< Binary columnar format. See BinaryLogWriter.
+};
+
 /**
  * @class Logger
  * @brief Class to manage log output file
@@ -27,8 +44,10 @@ class Logger {
    * @param [in] ini_file_name: Initialize file name
    * @param [in] enable_inilog: Enable flag to save ini files
    * @param [in] enable: Enable flag for logging
+   * @param [in] format: Format of the log file. The extension of the file name is replaced with ".bin" for the binary format.
    */
-  Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable = true);
+  Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable = true,
+         const LogFormat format = LogFormat::Csv);
   /**
    * @fn ~Logger
    * @brief Destructor
@@ -37,7 +56,7 @@ class Logger {
 
   /**
    * @fn Write
-   * @brief Write string to the log
+   * @brief Write string to the log. This is ignored in the binary format.
    * @param [in] log: Write target
    * @param [in] flag: Enable flag to write
    */
@@ -48,6 +67,14 @@ class Logger {
    * @param [in] loggable: loggable
    */
   void AddLoggable(ILoggable *loggable);
+  /**
+   * @fn AddLoggable
+   * @brief Add a loggable into the log list of the channel
+   * @note The loggable is written in the main log file when the output interval of the channel is not set.
+   * @param [in] loggable: loggable
+   * @param [in] channel: Name of the channel
+   */
+  void AddLoggable(ILoggable *loggable, const std::string &channel);
   /**
    * @fn ClearLoggable
    * @brief Clear the log list
@@ -66,12 +93,72 @@ class Logger {
    * @param add_newline: Add newline or not
    */
   void WriteValues(bool add_newline = true);
+  /**
+   * @fn WriteChannelValues
+   * @brief Write the values of the channels whose output time has come. Call this at every simulation step.
+   * @note The output times of a channel are the multiples of its interval in the integer ticks of the simulation time, so the time
+   *       stamps of all files are aligned without rounding errors.
+   * @param [in] elapsed_ticks: Elapsed time of the simulation [tick]
+   * @param [in] ticks_per_sec: Number of ticks in a second
+   */
+  void WriteChannelValues(const int64_t elapsed_ticks, const int64_t ticks_per_sec);
   /**
    * @fn WriteNewline
    * @brief Write newline
    */
   void WriteNewLine();
 
+  /**
+   * @fn EnableAsyncWriting
+   * @brief Write the file on a background thread. The raw values are stored in the ring of the buffers and converted to the text on the
+   *        writer thread. The simulation thread waits only when all buffers are waiting to be written.
+   * @note Call this before WriteHeaders.
+   * @param [in] num_of_buffers: Number of the buffers (64 KiB each)
+   */
+  void EnableAsyncWriting(const size_t num_of_buffers);
+  /**
+   * @fn EnableCompression
+   * @brief Write the log file as independently compressed blocks with the block index (e.g., default.csv.lz4b). See
+   *        CompressedLogStreamBuf for the format. The compression runs on the writer thread when the asynchronous writing is enabled.
+   * @note Call this before writing anything to the log file.
+   * @param [in] level: Compression level from 1 (fastest) to 9 (smallest)
+   * @param [in] block_size: Size of a block before compression [byte]
+   */
+  void EnableCompression(const int level, const size_t block_size);
+  /**
+   * @fn SetChannelInterval
+   * @brief Set the output interval of the channel. The loggables of the channel are written in their own file
+   *        (e.g., default_attitude.csv) with the time column at the interval instead of the main log file.
+   * @note Call this before adding the loggables of the channel.
+   * @param [in] channel: Name of the channel
+   * @param [in] interval_sec: Output interval [sec]. The channel is written in the main log file when this is zero or negative.
+   */
+  void SetChannelInterval(const std::string &channel, const double interval_sec);
+
+  /**
+   * @fn EnableFlightRecorder
+   * @brief Keep the latest rows of the main log in memory. They are recorded even when the log file is disabled, and written to
+   *        a file (e.g., default_flight_record0.csv) only when the recorder is triggered.
+   * @note Call this before WriteHeaders. The loggables in the channels with their own interval are not recorded.
+   * @param [in] num_of_rows: Number of the latest rows to keep
+   * @param [in] dump_on_nan: Trigger the recorder when a NaN value is logged for the first time
+   */
+  void EnableFlightRecorder(const size_t num_of_rows, const bool dump_on_nan = true);
+  /**
+   * @fn SetFlightRecorderTrigger
+   * @brief Set the user-defined trigger evaluated after each row is recorded. The recorder is triggered when the result changes
+   *        from false to true (e.g., attitude error exceeds the threshold).
+   * @param [in] trigger: Trigger function
+   * @param [in] reason: Reason of the trigger displayed with the output file
+   */
+  void SetFlightRecorderTrigger(const std::function<bool()> &trigger, const std::string &reason);
+  /**
+   * @fn TriggerFlightRecorder
+   * @brief Write the rows in the flight recorder to a new file. This does nothing when the flight recorder is not enabled.
+   * @param [in] reason: Reason of the trigger displayed with the output file (e.g., failure at the end of the case)
+   */
+  void TriggerFlightRecorder(const std::string &reason);
+
   /**
    * @fn IsEnabled
    * @brief Return enable flag of the log
@@ -100,11 +187,63 @@ class Logger {
   bool is_enabled_;                     //!< Enable flag for logging
   bool is_open_;                        //!< Is the CSV file opened?
   std::vector<ILoggable *> loggables_;  //!< Log list
+  std::string file_path_;               //!< Path to the log file
+  LogFormat format_;                    //!< Format of the log file
+  size_t num_of_async_buffers_ = 0;     //!< Number of the buffers of the writer thread (0 in the synchronous mode)
+  int compression_level_ = 0;           //!< Compression level (0 without compression)
+  size_t compression_block_size_ = 0;   //!< Size of a compressed block [byte]
+
+  std::unique_ptr<CompressedLogStreamBuf> compression_buf_;  //!< Compression of the file (nullptr without compression)
+  std::unique_ptr<std::ostream> compressed_stream_;          //!< Stream to the compression
+  std::ostream *output_stream_ = &csv_file_;                 //!< Stream to write the log
+
+  struct LogChannel;                                   //!< Loggables written in their own file at their own interval
+  std::vector<std::unique_ptr<LogChannel>> channels_;  //!< Channels with their own output interval
+
+  std::unique_ptr<AsyncLogWriter> async_writer_;    //!< Writer thread in the asynchronous mode (nullptr in the synchronous mode)
+  std::unique_ptr<BinaryLogWriter> binary_writer_;  //!< Writer of the binary format (nullptr in the CSV format)
+  std::string line_buffer_;                         //!< Buffer of a line in the CSV format
+  CsvLogSink csv_sink_{line_buffer_};               //!< Converter of the values in the CSV format
+
+  std::unique_ptr<FlightRecorder> flight_recorder_;  //!< Flight recorder (nullptr when it is not enabled)
+  bool is_dump_on_nan_enabled_ = false;              //!< Trigger the flight recorder when NaN is logged
+  bool is_nan_dumped_ = false;                       //!< Was the flight recorder triggered by NaN?
+  std::function<bool()> flight_recorder_trigger_;    //!< User-defined trigger of the flight recorder
+  std::string flight_recorder_trigger_reason_;       //!< Reason of the user-defined trigger
+  bool last_trigger_state_ = false;                  //!< Result of the user-defined trigger at the last row
+  unsigned int num_of_flight_records_ = 0;           //!< Number of the files written by the flight recorder
 
   bool is_enabled_inilog_;            //!< Enable flag to save ini files
   bool is_success_make_dir_ = false;  //!< Is success making a directory for log files
   std::string directory_path_;        //!< Path to the directory for log files
 
+  /**
+   * @fn Logger
+   * @brief Constructor of the logger of a channel
+   * @param [in] file_path: Path to the log file
+   * @param [in] enable: Enable flag for logging
+   * @param [in] format: Format of the log file
+   */
+  Logger(const std::string &file_path, const bool enable, const LogFormat format);
+
+  /**
+   * @fn OpenFile
+   * @brief Open the log file
+   * @param [in] file_path: Path to the log file
+   */
+  void OpenFile(const std::string &file_path);
+  /**
+   * @fn RecordFlightRecorder
+   * @brief Record the values to the flight recorder and check the triggers
+   */
+  void RecordFlightRecorder();
+  /**
+   * @fn FindChannel
+   * @brief Return the channel of the name or nullptr when it is not set
+   * @param [in] channel: Name of the channel
+   */
+  LogChannel *FindChannel(const std::string &channel);
+
   /**
    * @fn CreateDirectory
    * @brief Create a directory to store the log files
@@ -121,6 +260,12 @@ class Logger {
    * @return The extracted file name
    */
   std::string GetFileName(const std::string &path);
+  /**
+   * @fn WriteToFile
+   * @brief Write the bytes to the file directly or through the writer thread
+   * @param [in] data: Bytes to write
+   */
+  void WriteToFile(const std::string &data);
 };
 
 bool Logger::IsEnabled() { return is_enabled_; }
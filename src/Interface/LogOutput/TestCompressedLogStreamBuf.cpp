@@ -0,0 +1,128 @@
+/**
+ * @file TestCompressedLogStreamBuf.cpp
+ * @brief Test codes for CompressedLogStreamBuf class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <Library/utils/lz4_block.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "CompressedLogStreamBuf.h"
+
+namespace {
+/**
+ * @fn ReadRaw
+ * @brief Read the value in the little endian at the position of the file
+ */
+template <typename T>
+T ReadRaw(const std::string& file, const size_t pos) {
+  T value;
+  memcpy(&value, file.data() + pos, sizeof(T));
+  return value;
+}
+
+/**
+ * @fn WriteCompressedLog
+ * @brief Write the data through CompressedLogStreamBuf in pieces of various sizes and return the file
+ */
+std::string WriteCompressedLog(const std::string& raw, const size_t block_size, const int level) {
+  std::ostringstream file(std::ios::binary);
+  CompressedLogStreamBuf buf(file, block_size, level);
+  std::ostream stream(&buf);
+  size_t pos = 0;
+  for (size_t piece = 1; pos < raw.size(); piece = piece * 3 % 1000 + 1) {
+    const size_t size = std::min(piece, raw.size() - pos);
+    stream.write(raw.data() + pos, size);
+    pos += size;
+  }
+  stream.flush();
+  EXPECT_EQ(raw.size(), buf.GetRawSize());
+  buf.Finish();
+  EXPECT_EQ(file.str().size(), buf.GetFileSize());
+  return file.str();
+}
+
+/**
+ * @fn ReadCompressedLog
+ * @brief Decompress the file by the blocks listed in the index
+ * @param [out] num_of_stored_blocks: Number of the blocks stored without compression
+ */
+std::string ReadCompressedLog(const std::string& file, const size_t block_size, size_t& num_of_stored_blocks) {
+  // Header
+  EXPECT_EQ(0, memcmp(file.data(), "S2ELZ4B\0", 8));
+  EXPECT_EQ(1u, ReadRaw<uint32_t>(file, 8));
+  EXPECT_EQ(block_size, ReadRaw<uint32_t>(file, 12));
+  // Footer and index
+  EXPECT_EQ(0, memcmp(file.data() + file.size() - 8, "S2ELZEND", 8));
+  const uint64_t index_offset = ReadRaw<uint64_t>(file, file.size() - 16);
+  EXPECT_EQ(0, memcmp(file.data() + index_offset, "INDX", 4));
+  const uint64_t num_of_blocks = ReadRaw<uint64_t>(file, index_offset + 8);
+  EXPECT_EQ(file.size(), index_offset + 16 + num_of_blocks * 16 + 16);
+
+  std::string raw;
+  num_of_stored_blocks = 0;
+  for (uint64_t i = 0; i < num_of_blocks; i++) {
+    const uint64_t file_offset = ReadRaw<uint64_t>(file, index_offset + 16 + i * 16);
+    const uint64_t raw_offset = ReadRaw<uint64_t>(file, index_offset + 24 + i * 16);
+    EXPECT_EQ(raw.size(), raw_offset);
+    const uint32_t stored_size = ReadRaw<uint32_t>(file, file_offset);
+    const uint32_t raw_size = ReadRaw<uint32_t>(file, file_offset + 4);
+    // All blocks except the last one are full
+    if (i + 1 < num_of_blocks) EXPECT_EQ(block_size, raw_size);
+    const char* stored = file.data() + file_offset + 8;
+    if (stored_size & 0x80000000U) {
+      EXPECT_EQ(raw_size, stored_size & 0x7fffffffU);
+      raw.append(stored, raw_size);
+      num_of_stored_blocks++;
+    } else {
+      std::string block(raw_size, '\0');
+      EXPECT_TRUE(decompress_lz4_block(stored, stored_size, &block[0], raw_size));
+      raw += block;
+    }
+  }
+  return raw;
+}
+}  // namespace
+
+class CompressedLogStreamBufTest : public ::testing::TestWithParam<int> {};
+
+TEST_P(CompressedLogStreamBufTest, MultipleBlocks) {
+  std::string raw;
+  for (int i = 0; i < 5000; i++) {
+    raw += std::to_string(i * 0.001) + "," + std::to_string(i % 13) + ",6378137.0\n";
+  }
+  const size_t block_size = 4096;
+  const std::string file = WriteCompressedLog(raw, block_size, GetParam());
+  EXPECT_GT(raw.size() / 2, file.size());
+
+  size_t num_of_stored_blocks;
+  EXPECT_EQ(raw, ReadCompressedLog(file, block_size, num_of_stored_blocks));
+  EXPECT_EQ(0u, num_of_stored_blocks);
+}
+
+TEST_P(CompressedLogStreamBufTest, StoredBlocks) {
+  std::mt19937_64 engine(1);
+  std::string raw(10000, '\0');
+  for (auto& c : raw) c = (char)(engine() & 0xff);
+  const size_t block_size = 4096;
+  const std::string file = WriteCompressedLog(raw, block_size, GetParam());
+
+  size_t num_of_stored_blocks;
+  EXPECT_EQ(raw, ReadCompressedLog(file, block_size, num_of_stored_blocks));
+  // The random data is not compressed
+  EXPECT_EQ(3u, num_of_stored_blocks);
+}
+
+TEST_P(CompressedLogStreamBufTest, Empty) {
+  const std::string file = WriteCompressedLog("", 4096, GetParam());
+  size_t num_of_stored_blocks;
+  EXPECT_EQ("", ReadCompressedLog(file, 4096, num_of_stored_blocks));
+  EXPECT_EQ(16u + 16u + 16u, file.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(Level, CompressedLogStreamBufTest, ::testing::Values(1, 9));
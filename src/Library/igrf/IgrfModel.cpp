@@ -0,0 +1,434 @@
+/**
+ * @file IgrfModel.cpp
+ * @brief Reentrant IGRF (International Geo-magnetic reference frame) model
+ */
+
+#include "IgrfModel.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "../sgp4/sgp4ext.h"
+
+using namespace std;
+
+// Same constants as igrf.cpp to keep the identical results
+#define URAD (180. / 3.14159265359)
+#define PI 3.14159265358979323846
+#define DEG2RAD 0.017453292519943295769236907684886  // PI/180
+#define RAD2DEG (180 / PI)
+
+static const double kEarthEquatorialRadius_km = 6378.137;  //!< Equatorial radius of WGS84 [km]
+static const double kEarthFlattening = 298.25722;          //!< Inverse flattening of WGS84
+static const double kReferenceRadius_km = 6371.2;          //!< Reference radius of IGRF [km]
+
+map<string, shared_ptr<const IgrfCoefficients>> IgrfCoefficients::loaded_;
+mutex IgrfCoefficients::loaded_mutex_;
+
+IgrfCoefficients::IgrfCoefficients(const string& file_path) {
+  is_loaded_ = ReadFile(file_path);
+
+  // Factors of the recursion P(n,m) = a(n,m) cos(theta) P(n-1,m) - b(n,m) P(n-2,m) for m < n
+  // and the derivative dP(n,m)/dtheta = (n cos(theta) P(n,m) - (n+m) P(n-1,m)) / sin(theta)
+  const int table_size = TriangularIndex(kMaxDegree + 1, 0);
+  recursion_a_.assign(table_size, 0.0);
+  recursion_b_.assign(table_size, 0.0);
+  derivative_coeff_.assign(table_size, 0.0);
+  for (int n = 1; n <= kMaxDegree; n++) {
+    for (int m = 0; m <= n; m++) {
+      const int i = TriangularIndex(n, m);
+      if (m < n) {
+        recursion_a_[i] = (double)(2 * n - 1) / (n - m);
+        recursion_b_[i] = (double)(n + m - 1) / (n - m);
+      } else {
+        recursion_a_[i] = (double)(2 * n - 1);  // P(n,n) = (2n-1) sin(theta) P(n-1,n-1)
+      }
+      derivative_coeff_[i] = (double)(n + m);
+    }
+  }
+}
+
+shared_ptr<const IgrfCoefficients> IgrfCoefficients::Load(const string& file_path) {
+  lock_guard<mutex> lock(loaded_mutex_);
+  auto itr = loaded_.find(file_path);
+  if (itr != loaded_.end()) return itr->second;
+
+  auto coefficients = make_shared<const IgrfCoefficients>(file_path);
+  loaded_[file_path] = coefficients;
+  return coefficients;
+}
+
+bool IgrfCoefficients::ReadFile(const string& file_path) {
+  ifstream coeff_file(file_path);
+  if (!coeff_file.is_open()) {
+    cerr << "IGRF coefficient file not found: " << file_path << "\n";
+    return false;
+  }
+
+  // Line-1: maximum degree, number of columns, valid period
+  string line;
+  getline(coeff_file, line);
+  istringstream line1(line);
+  if (!(line1 >> max_degree_ >> num_of_columns_ >> valid_start_year_ >> valid_end_year_)) {
+    cerr << "IGRF coefficient file Line-1 format error: " << file_path << "\n";
+    return false;
+  }
+  if ((max_degree_ < 8) || (max_degree_ > kMaxDegree) || (num_of_columns_ < 2)) {
+    cerr << "IGRF coefficient file Line-1 invalid: " << file_path << "\n";
+    return false;
+  }
+
+  // Line-2: epochs of the columns. The last column is the secular variation.
+  getline(coeff_file, line);
+  istringstream line2(line);
+  string label;
+  int n, m;
+  line2 >> label >> n >> m;
+  epochs_.resize(num_of_columns_ - 1);
+  for (double& epoch : epochs_) {
+    if (!(line2 >> epoch)) {
+      cerr << "IGRF coefficient file Line-2 short: " << file_path << "\n";
+      return false;
+    }
+  }
+
+  // Coefficients: g10, g11, h11, g20, g21, h21, ...
+  const int num_of_lines = (max_degree_ + 1) * (max_degree_ + 1) - 1;
+  coefficients_.resize(num_of_lines * num_of_columns_);
+  for (int i = 0; i < num_of_lines; i++) {
+    if (!getline(coeff_file, line)) {
+      cerr << "IGRF coefficient file EOF before Line-" << i + 3 << ": " << file_path << "\n";
+      return false;
+    }
+    istringstream line_stream(line);
+    line_stream >> label >> n >> m;
+    for (int column = 0; column < num_of_columns_; column++) {
+      if (!(line_stream >> coefficients_[i * num_of_columns_ + column])) {
+        cerr << "IGRF coefficient file Line-" << i + 3 << " short: " << file_path << "\n";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+IgrfModel::IgrfModel(shared_ptr<const IgrfCoefficients> coefficients) : coefficients_(coefficients), coefficients_year_(NAN) {}
+
+IgrfModel::IgrfModel(const string& file_path) : IgrfModel(IgrfCoefficients::Load(file_path)) {}
+
+void IgrfModel::SelectEpoch(const double decyear) {
+  is_epoch_selected_ = true;
+  coefficients_year_ = NAN;
+  max_degree_ = 0;
+  for (int i = 0; i < kTableSize; i++) {
+    gc_epoch_[i] = 0.0;
+    gs_epoch_[i] = 0.0;
+    gc_rate_[i] = 0.0;
+    gs_rate_[i] = 0.0;
+  }
+  if (!coefficients_->IsLoaded()) return;
+
+  const IgrfCoefficients& coeff = *coefficients_;
+  const int num_of_columns = coeff.GetNumOfColumns();
+  if ((decyear < coeff.valid_start_year_) || (decyear > coeff.valid_end_year_)) {
+    cerr << "IGRF is not defined for " << decyear << "\n";
+  }
+
+  // Find the interval of the epochs including the year. After the last epoch, the secular variation column is used.
+  int column = 1;
+  for (; column < num_of_columns - 1; column++) {
+    if (decyear < coeff.GetEpoch(column)) break;
+  }
+  const bool use_secular_variation = (column == num_of_columns - 1);
+  const double epoch_begin = coeff.GetEpoch(column - 1);
+  const double epoch_interval = use_secular_variation ? 1.0 : coeff.GetEpoch(column) - epoch_begin;
+  epoch_ = epoch_begin;
+
+  // Schmidt quasi-normalization same as tcoef in igrf.cpp. The factor sqrt(2 (n-m)! / (n+m)!) converts the coefficients for the
+  // unnormalized Legendre functions.
+  int line = 0;
+  auto read = [&](double& gh, double& ght) {
+    gh = coeff.GetCoefficient(line, column - 1);
+    const double next = coeff.GetCoefficient(line, column);
+    ght = use_secular_variation ? next : (next - gh) / epoch_interval;
+    line++;
+    return (gh != 0.0) || (ght != 0.0);
+  };
+  for (int n = 1; n <= coeff.GetMaxDegree(); n++) {
+    const int i0 = IgrfCoefficients::TriangularIndex(n, 0);
+    if (read(gc_epoch_[i0], gc_rate_[i0])) max_degree_ = n;
+    double fac = sqrt(2.);
+    for (int m = 1; m <= n; m++) {
+      const int i = i0 + m;
+      if (read(gc_epoch_[i], gc_rate_[i])) max_degree_ = n;
+      if (read(gs_epoch_[i], gs_rate_[i])) max_degree_ = n;
+      fac /= sqrt((double)((n + m) * (n - m + 1)));
+      gc_epoch_[i] *= fac;
+      gs_epoch_[i] *= fac;
+      gc_rate_[i] *= fac;
+      gs_rate_[i] *= fac;
+    }
+  }
+}
+
+void IgrfModel::SetCoefficientUpdateInterval(const double interval_year) {
+  update_interval_year_ = interval_year > 0.0 ? interval_year : 0.0;
+  coefficients_year_ = NAN;
+}
+
+void IgrfModel::UpdateCoefficients(const double decyear) {
+  if (!is_epoch_selected_) SelectEpoch(decyear);
+
+  // The center of the interval is used so that the cached coefficients do not depend on the calculation history
+  double year = decyear;
+  if (update_interval_year_ > 0.0) {
+    year = epoch_ + (floor((decyear - epoch_) / update_interval_year_) + 0.5) * update_interval_year_;
+  }
+  if (year == coefficients_year_) return;
+  coefficients_year_ = year;
+
+  const double dyear = year - epoch_;
+  const int table_size = IgrfCoefficients::TriangularIndex(max_degree_ + 1, 0);
+  for (int i = 0; i < table_size; i++) {
+    gc_[i] = gc_epoch_[i] + gc_rate_[i] * dyear;
+    gs_[i] = gs_epoch_[i] + gs_rate_[i] * dyear;
+  }
+}
+
+void IgrfModel::CalcMagEci(const double decyear, const double latrad, const double lonrad, const double alt, const double side, double* mag) {
+  UpdateCoefficients(decyear);
+
+  const double cth = CalcMagNed(latrad * RAD2DEG, lonrad * RAD2DEG, alt / 1000., mag);
+  const double thetarad = acos(cth);
+
+  // Magnetic field in the local frame to ECI
+  RotationY(mag, mag, 180 * DEG2RAD - thetarad);
+  RotationZ(mag, mag, -lonrad);
+  RotationZ(mag, mag, -side);
+}
+
+void IgrfModel::CalcMagEci(const double decyear, const double* latrad, const double* lonrad, const double* alt, const double side, double* mag,
+                           const size_t num) {
+  UpdateCoefficients(decyear);
+
+  double latdeg[kBatchSize], londeg[kBatchSize], alt_km[kBatchSize], cth[kBatchSize];
+  for (size_t head = 0; head < num; head += kBatchSize) {
+    const int num_batch = num - head < kBatchSize ? (int)(num - head) : kBatchSize;
+    for (int k = 0; k < num_batch; k++) {
+      latdeg[k] = latrad[head + k] * RAD2DEG;
+      londeg[k] = lonrad[head + k] * RAD2DEG;
+      alt_km[k] = alt[head + k] / 1000.;
+    }
+    double* mag_batch = &mag[head * 3];
+    CalcMagNedBatch(latdeg, londeg, alt_km, mag_batch, cth, num_batch);
+
+    for (int k = 0; k < num_batch; k++) {
+      double* mag_k = &mag_batch[k * 3];
+      RotationY(mag_k, mag_k, 180 * DEG2RAD - acos(cth[k]));
+      RotationZ(mag_k, mag_k, -lonrad[head + k]);
+      RotationZ(mag_k, mag_k, -side);
+    }
+  }
+}
+
+/**
+ * @fn CalcGeocentricPosition
+ * @brief Convert the geodetic position to the geocentric radius and colatitude same as mfldg in igrf.cpp
+ * @param [in] latdeg: Geodetic latitude [deg]
+ * @param [in] alt_km: Altitude [km]
+ * @param [out] r: Geocentric radius [km]
+ * @param [out] cth: Cosine of the geocentric colatitude
+ * @param [out] sth: Sine of the geocentric colatitude
+ */
+static inline void CalcGeocentricPosition(const double latdeg, const double alt_km, double& r, double& cth, double& sth) {
+  const double rpre = 1. - 1. / kEarthFlattening;
+  const double re = kEarthEquatorialRadius_km;
+  const double re2 = re * re;
+  const double re4 = re2 * re2;
+  const double rp = re * rpre;
+  const double rp2 = rp * rp;
+  const double rp4 = rp2 * rp2;
+
+  const double rlat = latdeg / URAD;
+  const double slat = sin(rlat);
+  const double slat2 = slat * slat;
+  const double clat2 = 1. - slat2;
+  const double rm2 = re2 * clat2 + rp2 * slat2;
+  const double rm = sqrt(rm2);
+  const double rrm = (re4 * clat2 + rp4 * slat2) / rm2;
+  r = sqrt(rrm + 2. * alt_km * rm + alt_km * alt_km);
+  cth = slat * (alt_km + rp2 / rm) / r;
+  sth = sqrt(1. - cth * cth);
+}
+
+double IgrfModel::CalcMagNed(const double latdeg, const double londeg, const double alt_km, double* mag) {
+  const IgrfCoefficients& coeff = *coefficients_;
+  const int max_degree = max_degree_;
+
+  double r, cth, sth;
+  CalcGeocentricPosition(latdeg, alt_km, r, cth, sth);
+  const double inv_sth = 1. / sth;
+  const double phi = londeg / URAD;
+  const double cph = cos(phi);
+  const double sph = sin(phi);
+
+  csp_[0] = 1.;
+  snp_[0] = 0.;
+  for (int m = 0; m < max_degree; m++) {
+    csp_[m + 1] = csp_[m] * cph - snp_[m] * sph;
+    snp_[m + 1] = snp_[m] * cph + csp_[m] * sph;
+  }
+
+  // Legendre functions are calculated row by row (n = const) and only the last three rows are kept
+  double *p_prev2 = p_[0], *p_prev = p_[1], *p_curr = p_[2];
+  for (int m = 0; m < kRowSize; m++) {
+    p_prev2[m] = 0.;
+    p_prev[m] = 0.;
+    p_curr[m] = 0.;
+  }
+  p_prev[0] = 1.;  // P(0,0)
+
+  const double t = kReferenceRadius_km / r;
+  double rar = t * t;  // (a/r)^(n+2)
+  double x = 0., y = 0., z = 0.;
+  for (int n = 1; n <= max_degree; n++) {
+    rar *= t;
+
+    // Legendre functions of degree n. P(n-2,n-1) and P(n-1,n) are zero.
+    const double* a = coeff.GetRecursionA(n);
+    const double* b = coeff.GetRecursionB(n);
+    for (int m = 0; m < n; m++) {
+      p_curr[m] = a[m] * cth * p_prev[m] - b[m] * p_prev2[m];
+    }
+    p_curr[n] = a[n] * sth * p_prev[n - 1];
+
+    // Summation over the order m
+    const double* gc = &gc_[IgrfCoefficients::TriangularIndex(n, 0)];
+    const double* gs = &gs_[IgrfCoefficients::TriangularIndex(n, 0)];
+    const double* d = coeff.GetDerivativeCoeff(n);
+    const double n_cth = n * cth;
+    double tx = 0., ty = 0., tz = 0.;
+    for (int m = 0; m <= n; m++) {
+      const double dp = (n_cth * p_curr[m] - d[m] * p_prev[m]) * inv_sth;
+      const double gcs = gc[m] * csp_[m] + gs[m] * snp_[m];
+      const double gsc = gc[m] * snp_[m] - gs[m] * csp_[m];
+      tx += gcs * dp;
+      ty += gsc * p_curr[m] * m;
+      tz += gcs * p_curr[m];
+    }
+    x += rar * tx;
+    y += rar * ty;
+    z -= rar * tz * (n + 1);
+
+    // next step
+    double* tmp = p_prev2;
+    p_prev2 = p_prev;
+    p_prev = p_curr;
+    p_curr = tmp;
+  }
+  y *= inv_sth;
+
+  mag[0] = x;
+  mag[1] = y;
+  mag[2] = z;
+  return cth;
+}
+
+void IgrfModel::CalcMagNedBatch(const double* latdeg, const double* londeg, const double* alt_km, double* mag, double* cth, const int num) {
+  // Structure of arrays: the element (m, k) of a row is stored at m * kBatchSize + k, where k is the index of the position
+  const IgrfCoefficients& coeff = *coefficients_;
+  const int max_degree = max_degree_;
+  const int B = kBatchSize;
+
+  double sth[B], inv_sth[B], t[B], rar[B];
+  for (int k = 0; k < B; k++) {
+    // Unused lanes repeat the first position to keep the calculation finite
+    const int src = k < num ? k : 0;
+    double r;
+    CalcGeocentricPosition(latdeg[src], alt_km[src], r, cth[k], sth[k]);
+    inv_sth[k] = 1. / sth[k];
+    t[k] = kReferenceRadius_km / r;
+    rar[k] = t[k] * t[k];
+    const double phi = londeg[src] / URAD;
+    batch_csp_[k] = 1.;
+    batch_snp_[k] = 0.;
+    if (max_degree > 0) {
+      batch_csp_[B + k] = cos(phi);
+      batch_snp_[B + k] = sin(phi);
+    }
+  }
+  for (int m = 1; m < max_degree; m++) {
+    const double *c = &batch_csp_[m * B], *s = &batch_snp_[m * B];
+    double *c_next = &batch_csp_[(m + 1) * B], *s_next = &batch_snp_[(m + 1) * B];
+    for (int k = 0; k < B; k++) {
+      c_next[k] = c[k] * batch_csp_[B + k] - s[k] * batch_snp_[B + k];
+      s_next[k] = s[k] * batch_csp_[B + k] + c[k] * batch_snp_[B + k];
+    }
+  }
+
+  double *p_prev2 = batch_p_[0], *p_prev = batch_p_[1], *p_curr = batch_p_[2];
+  for (int i = 0; i < kRowSize * B; i++) {
+    p_prev2[i] = 0.;
+    p_prev[i] = 0.;
+    p_curr[i] = 0.;
+  }
+  for (int k = 0; k < B; k++) p_prev[k] = 1.;  // P(0,0)
+
+  double x[B] = {}, y[B] = {}, z[B] = {};
+  for (int n = 1; n <= max_degree; n++) {
+    const double* a = coeff.GetRecursionA(n);
+    const double* b = coeff.GetRecursionB(n);
+    for (int m = 0; m < n; m++) {
+      const double *pp = &p_prev[m * B], *pp2 = &p_prev2[m * B];
+      double* pc = &p_curr[m * B];
+      for (int k = 0; k < B; k++) {
+        pc[k] = a[m] * cth[k] * pp[k] - b[m] * pp2[k];
+      }
+    }
+    {
+      const double* pp = &p_prev[(n - 1) * B];
+      double* pc = &p_curr[n * B];
+      for (int k = 0; k < B; k++) {
+        pc[k] = a[n] * sth[k] * pp[k];
+      }
+    }
+
+    const double* gc = &gc_[IgrfCoefficients::TriangularIndex(n, 0)];
+    const double* gs = &gs_[IgrfCoefficients::TriangularIndex(n, 0)];
+    const double* d = coeff.GetDerivativeCoeff(n);
+    double tx[B] = {}, ty[B] = {}, tz[B] = {};
+    for (int m = 0; m <= n; m++) {
+      const double *pc = &p_curr[m * B], *pp = &p_prev[m * B];
+      const double *c = &batch_csp_[m * B], *s = &batch_snp_[m * B];
+      for (int k = 0; k < B; k++) {
+        const double dp = (n * cth[k] * pc[k] - d[m] * pp[k]) * inv_sth[k];
+        const double gcs = gc[m] * c[k] + gs[m] * s[k];
+        const double gsc = gc[m] * s[k] - gs[m] * c[k];
+        tx[k] += gcs * dp;
+        ty[k] += gsc * pc[k] * m;
+        tz[k] += gcs * pc[k];
+      }
+    }
+    for (int k = 0; k < B; k++) {
+      rar[k] *= t[k];
+      x[k] += rar[k] * tx[k];
+      y[k] += rar[k] * ty[k];
+      z[k] -= rar[k] * tz[k] * (n + 1);
+    }
+
+    // next step
+    double* tmp = p_prev2;
+    p_prev2 = p_prev;
+    p_prev = p_curr;
+    p_curr = tmp;
+  }
+
+  for (int k = 0; k < num; k++) {
+    mag[k * 3 + 0] = x[k];
+    mag[k * 3 + 1] = y[k] * inv_sth[k];
+    mag[k * 3 + 2] = z[k];
+  }
+}
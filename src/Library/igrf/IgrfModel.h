@@ -0,0 +1,242 @@
+/**
+ * @file IgrfModel.h
+ * @brief Reentrant IGRF (International Geo-magnetic reference frame) model
+ * @note The calculation is the same as igrf.cpp, which was copied from https://www.gsj.jp/data/openfile/no0423/index.html
+ */
+
+#ifndef __IGRF_MODEL_H__
+#define __IGRF_MODEL_H__
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class IgrfCoefficients
+ * @brief Immutable table of the IGRF coefficient file shared between IgrfModel instances
+ */
+class IgrfCoefficients {
+ public:
+  static const int kMaxDegree = 19;  //!< Maximum degree supported by the model
+
+  /**
+   * @fn IgrfCoefficients
+   * @brief Constructor
+   * @param [in] file_path: Path to the IGRF coefficient file (igrfXX.coef)
+   */
+  explicit IgrfCoefficients(const std::string& file_path);
+
+  /**
+   * @fn Load
+   * @brief Return the coefficient table of the file
+   * @note The file is read only once per process and shared between all callers
+   * @param [in] file_path: Path to the IGRF coefficient file
+   */
+  static std::shared_ptr<const IgrfCoefficients> Load(const std::string& file_path);
+
+  /**
+   * @fn IsLoaded
+   * @brief Return true when the file is read successfully
+   */
+  inline bool IsLoaded() const { return is_loaded_; }
+  /**
+   * @fn GetMaxDegree
+   * @brief Return maximum degree of the coefficients in the file
+   */
+  inline int GetMaxDegree() const { return max_degree_; }
+  /**
+   * @fn GetNumOfColumns
+   * @brief Return number of the coefficient columns including the secular variation column
+   */
+  inline int GetNumOfColumns() const { return num_of_columns_; }
+  /**
+   * @fn GetEpoch
+   * @brief Return epoch of the column [year]
+   * @param [in] column: Column index (0 <= column < GetNumOfColumns() - 1)
+   */
+  inline double GetEpoch(const int column) const { return epochs_[column]; }
+  /**
+   * @fn GetCoefficient
+   * @brief Return the coefficient in the file
+   * @param [in] line: Index of the coefficient line in the file order (g10, g11, h11, g20, ...)
+   * @param [in] column: Column index. The last column is the secular variation [nT/year].
+   */
+  inline double GetCoefficient(const int line, const int column) const { return coefficients_[line * num_of_columns_ + column]; }
+
+  /**
+   * @fn TriangularIndex
+   * @brief Index of the (n, m) element in the flat lower triangular tables
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  static inline int TriangularIndex(const int n, const int m) { return n * (n + 1) / 2 + m; }
+  /**
+   * @fn GetRecursionA
+   * @brief Return head pointer of the coefficients (2n-1)/(n-m) multiplied to cos(theta)P(n-1,m) in the Legendre recursion of degree n
+   */
+  inline const double* GetRecursionA(const int n) const { return &recursion_a_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetRecursionB
+   * @brief Return head pointer of the coefficients (n+m-1)/(n-m) multiplied to P(n-2,m) in the Legendre recursion of degree n
+   */
+  inline const double* GetRecursionB(const int n) const { return &recursion_b_[TriangularIndex(n, 0)]; }
+  /**
+   * @fn GetDerivativeCoeff
+   * @brief Return head pointer of the coefficients (n+m) multiplied to P(n-1,m) in the derivative of degree n
+   */
+  inline const double* GetDerivativeCoeff(const int n) const { return &derivative_coeff_[TriangularIndex(n, 0)]; }
+
+ private:
+  bool is_loaded_ = false;            //!< Flag for the successful reading
+  int max_degree_ = 0;                //!< Maximum degree in the file
+  int num_of_columns_ = 0;            //!< Number of the coefficient columns
+  double valid_start_year_ = 0.0;     //!< Start of the valid period of the model [year]
+  double valid_end_year_ = 0.0;       //!< End of the valid period of the model [year]
+  std::vector<double> epochs_;        //!< Epochs of the columns [year]
+  std::vector<double> coefficients_;  //!< Coefficients [nT] stored as [line][column]
+
+  // Precomputed factors of the unnormalized associated Legendre functions
+  std::vector<double> recursion_a_;       //!< (2n-1)/(n-m)
+  std::vector<double> recursion_b_;       //!< (n+m-1)/(n-m)
+  std::vector<double> derivative_coeff_;  //!< (n+m)
+
+  static std::map<std::string, std::shared_ptr<const IgrfCoefficients>> loaded_;  //!< Loaded coefficient tables
+  static std::mutex loaded_mutex_;                                                //!< Mutex for loaded_
+
+  friend class IgrfModel;
+
+  /**
+   * @fn ReadFile
+   * @brief Read the IGRF coefficient file
+   * @param [in] file_path: Path to the IGRF coefficient file
+   * @return True when the file is read successfully
+   */
+  bool ReadFile(const std::string& file_path);
+};
+
+/**
+ * @class IgrfModel
+ * @brief Reentrant IGRF model
+ * @note The coefficient table is shared read-only, and each instance has its own Schmidt-normalized coefficients of the selected epoch and
+ *       the scratch workspace. Different instances can be used concurrently from different threads.
+ * @note The time-dependent coefficients are evaluated at the center of the update interval and reused within the interval.
+ *       The Legendre functions are calculated row by row (n = const) so that the loops over the order m have no dependency, and the batch
+ *       calculation runs the same kernel for kBatchSize positions in the structure of arrays.
+ */
+class IgrfModel {
+ public:
+  /**
+   * @fn IgrfModel
+   * @brief Constructor
+   * @param [in] coefficients: Coefficient table
+   */
+  explicit IgrfModel(std::shared_ptr<const IgrfCoefficients> coefficients);
+  /**
+   * @fn IgrfModel
+   * @brief Constructor
+   * @param [in] file_path: Path to the IGRF coefficient file
+   */
+  explicit IgrfModel(const std::string& file_path);
+
+  /**
+   * @fn SelectEpoch
+   * @brief Select the coefficient epoch including the year
+   * @note Called automatically at the first calculation. The field is linearly extrapolated from the selected epoch after that.
+   * @param [in] decyear: Decimal year [year]
+   */
+  void SelectEpoch(const double decyear);
+  /**
+   * @fn SetCoefficientUpdateInterval
+   * @brief Set the update interval of the time-dependent coefficients
+   * @param [in] interval_year: Update interval [year]. The coefficients are updated at every calculation when it is zero.
+   */
+  void SetCoefficientUpdateInterval(const double interval_year);
+
+  /**
+   * @fn CalcMagEci
+   * @brief Calculate magnetic field vector in the ECI frame
+   * @param [in] decyear: Decimal year [year]
+   * @param [in] latrad: Geodetic latitude [rad]
+   * @param [in] lonrad: Longitude [rad]
+   * @param [in] alt: Altitude [m]
+   * @param [in] side: Greenwich sidereal time [rad]
+   * @param [out] mag: Magnetic field vector in the ECI frame [nT]
+   */
+  void CalcMagEci(const double decyear, const double latrad, const double lonrad, const double alt, const double side, double* mag);
+  /**
+   * @fn CalcMagEci
+   * @brief Calculate magnetic field vectors in the ECI frame for multiple positions at once
+   * @param [in] decyear: Decimal year [year]
+   * @param [in] latrad: Geodetic latitudes [rad]
+   * @param [in] lonrad: Longitudes [rad]
+   * @param [in] alt: Altitudes [m]
+   * @param [in] side: Greenwich sidereal time [rad]
+   * @param [out] mag: Magnetic field vectors in the ECI frame [nT] stored as [position][axis]
+   * @param [in] num: Number of positions
+   */
+  void CalcMagEci(const double decyear, const double* latrad, const double* lonrad, const double* alt, const double side, double* mag,
+                  const size_t num);
+
+ private:
+  static const int kMaxDegree = IgrfCoefficients::kMaxDegree;             //!< Maximum degree of the tables
+  static const int kTableSize = (kMaxDegree + 1) * (kMaxDegree + 2) / 2;  //!< Size of the flat lower triangular tables
+  static const int kBatchSize = 8;                                        //!< Number of positions calculated together in the batch calculation
+  static const int kRowSize = kMaxDegree + 2;                             //!< Size of a row of the Legendre functions
+
+  std::shared_ptr<const IgrfCoefficients> coefficients_;  //!< Shared coefficient table
+  bool is_epoch_selected_ = false;                        //!< Flag for the epoch selection
+  int max_degree_ = 0;                                    //!< Maximum degree of the selected epoch
+  double epoch_ = 0.0;                                    //!< Reference year of the selected coefficients [year]
+  double gc_epoch_[kTableSize];                           //!< Schmidt-normalized cosine coefficients g(n,m) at the epoch [nT]
+  double gs_epoch_[kTableSize];                           //!< Schmidt-normalized sine coefficients h(n,m) at the epoch [nT]
+  double gc_rate_[kTableSize];                            //!< Secular variations of gc_epoch_ [nT/year]
+  double gs_rate_[kTableSize];                            //!< Secular variations of gs_epoch_ [nT/year]
+
+  // Time-dependent coefficients cache
+  double update_interval_year_ = 0.0;  //!< Update interval of the time-dependent coefficients [year]
+  double coefficients_year_;           //!< Year of the cached coefficients [year]
+  double gc_[kTableSize];              //!< Cosine coefficients at coefficients_year_ [nT]
+  double gs_[kTableSize];              //!< Sine coefficients at coefficients_year_ [nT]
+
+  // Scratch workspace
+  double csp_[kMaxDegree + 1];                       //!< cos(m * longitude)
+  double snp_[kMaxDegree + 1];                       //!< sin(m * longitude)
+  double p_[3][kRowSize];                            //!< Last three rows (n-2, n-1, n) of the Legendre functions
+  double batch_csp_[(kMaxDegree + 1) * kBatchSize];  //!< cos(m * longitude) for kBatchSize positions (structure of arrays)
+  double batch_snp_[(kMaxDegree + 1) * kBatchSize];  //!< sin(m * longitude) for kBatchSize positions (structure of arrays)
+  double batch_p_[3][kRowSize * kBatchSize];         //!< Last three rows of the Legendre functions for kBatchSize positions
+
+  /**
+   * @fn UpdateCoefficients
+   * @brief Update the time-dependent coefficients when the year is out of the cached interval
+   * @param [in] decyear: Decimal year [year]
+   */
+  void UpdateCoefficients(const double decyear);
+  /**
+   * @fn CalcMagNedBatch
+   * @brief Calculate magnetic field vectors in the local north-east-down frame for up to kBatchSize positions
+   * @param [in] latdeg: Geodetic latitudes [deg]
+   * @param [in] londeg: Longitudes [deg]
+   * @param [in] alt_km: Altitudes [km]
+   * @param [out] mag: Magnetic field vectors in the north-east-down frame [nT] stored as [position][axis]
+   * @param [out] cth: Cosine of the geocentric colatitudes
+   * @param [in] num: Number of positions (<= kBatchSize)
+   */
+  void CalcMagNedBatch(const double* latdeg, const double* londeg, const double* alt_km, double* mag, double* cth, const int num);
+
+  /**
+   * @fn CalcMagNed
+   * @brief Calculate magnetic field vector in the local north-east-down frame with the cached coefficients
+   * @param [in] latdeg: Geodetic latitude [deg]
+   * @param [in] londeg: Longitude [deg]
+   * @param [in] alt_km: Altitude [km]
+   * @param [out] mag: Magnetic field vector in the north-east-down frame [nT]
+   * @return Cosine of the geocentric colatitude
+   */
+  double CalcMagNed(const double latdeg, const double londeg, const double alt_km, double* mag);
+};
+
+#endif  //__IGRF_MODEL_H__
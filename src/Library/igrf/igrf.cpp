@@ -46,13 +46,15 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
 using namespace std;
 
 #include "../sgp4/sgp4ext.h"
+#include "IgrfModel.h"
 #include "igrf.h"
 
-double testglobal[3];
-
 #ifdef WIN32
 #pragma warning(disable : 4996)  // fopenなど回避
 #pragma warning(disable : 4305)  // double->float回避
@@ -82,12 +84,21 @@ static double rar[MxOD + 1], csp[MxOD + 1], snp[MxOD + 1], p[MxOD + 2][MxOD + 1]
 
 static double vgh[MxOD + 1][MxOD + 1], vght[MxOD + 1][MxOD + 1];
 
-// coeff file path
-static char coeff_file[256];
+// coeff file path. It is shared by the threads, so it is accessed under the lock.
+static string coeff_file;
+static mutex coeff_file_mutex;
 
 static void fcalc(void);
 
-void set_file_path(const char *fname) { strcpy(coeff_file, fname); }
+void set_file_path(const char *fname) {
+  lock_guard<mutex> lock(coeff_file_mutex);
+  coeff_file = fname;
+}
+
+static string get_file_path(void) {
+  lock_guard<mutex> lock(coeff_file_mutex);
+  return coeff_file;
+}
 
 static void fcalc(void) /* This is an internal function */
 {
@@ -312,7 +323,7 @@ void gigrf(int gen, double year) {
     fprintf(stderr, "gigrf: unknown  NGEN = %d\n", gen);
     exit(1);
   }
-  strcpy(file, coeff_file);
+  snprintf(file, sizeof(file), "%s", get_file_path().c_str());
   // strstr(const char *s1, const char *s2)=>文字列s1から文字列s2を検索
   // if ((pstr=strstr(file,"10")) == NULL)
   // if ((pstr = strstr(file, "11")) == NULL)
@@ -440,33 +451,15 @@ int TransMagaxisToECI(const double *mag, double *pos, double lonrad, double thet
 
 // IGRFの計算を実行するメインルーチン
 // Output	:	mag[3]	ECI座標での磁界の値[nT]
+// Compatible interface of IgrfModel. Each thread has its own model, and the coefficient table is shared.
+// The model is reloaded when the file path is changed by set_file_path.
 void IgrfCalc(double decyear, double latrad, double lonrad, double alt, double side, double *mag) {
-  static bool first_flg = true;
-
-  if (first_flg == true) {
-    // gigrf(10,decyear);	//ファイル読み込み
-    // gigrf(11, decyear);
-    // gigrf(12, decyear);
-    gigrf(13, decyear);
-    first_flg = false;
+  static thread_local unique_ptr<IgrfModel> model;
+  static thread_local string model_file_path;
+  const string file_path = get_file_path();
+  if (!model || file_path != model_file_path) {
+    model.reset(new IgrfModel(file_path));
+    model_file_path = file_path;
   }
-  tyear(decyear);  //実行年の設定
-  igrfc(latrad * RAD2DEG, lonrad * RAD2DEG, alt,
-        &f);  //実行位置の設定&Executeはこの中に含む
-
-  mag[0] = x;  // x,y,zはigrf.cppグローバル変数
-  mag[1] = y;
-  mag[2] = z;
-
-  // cout <<"mag_ned:["<< mag[0]<<","<<mag[1]<<","<<mag[2]<<"]\n";
-
-  double thetarad = acos(cth);  //[0<=theta<=pi?]
-
-  // cout << "Theta:"<< thetarad<<"\n";
-
-  testglobal[0] = mag[0];
-  testglobal[1] = mag[1];
-  testglobal[2] = mag[2];
-
-  TransMagaxisToECI(mag, mag, lonrad, thetarad, side);
-}
\ No newline at end of file
+  model->CalcMagEci(decyear, latrad, lonrad, alt, side, mag);
+}
@@ -7,8 +7,6 @@
 #ifndef __igrf_H__
 #define __igrf_H__
 
-extern double testglobal[3];
-
 void set_file_path(const char *fname);
 void field(double are, double aflat, double ara, int maxoda);
 void tcoef(double *agh, double *aght, double atzero, int kexta, double aext[3]);
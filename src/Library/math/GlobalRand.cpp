@@ -5,20 +5,24 @@
 
 #include "GlobalRand.h"
 
-GlobalRand g_rand;
+thread_local GlobalRand g_rand;
 
-GlobalRand::GlobalRand() { seed_ = 0xdeadbeef; }
+GlobalRand::GlobalRand() { SetCaseSeed(0xdeadbeef, 0); }
 
-void GlobalRand::SetSeed(long seed) {
-  base_rand_.init(seed);
-  // double dl = base_rand_;
+void GlobalRand::SetSeed(long seed) { SetCaseSeed((uint64_t)seed, 0); }
+
+void GlobalRand::SetCaseSeed(const uint64_t campaign_seed, const uint64_t case_id) {
+  campaign_seed_ = campaign_seed;
+  case_id_ = case_id;
+  base_rand_ = libra::PhiloxRand(campaign_seed_, case_id_, "", 0);
 }
 
-long GlobalRand::MakeSeed() {
-  double rand = base_rand_;
+long GlobalRand::MakeSeed() { return ConvertToSeed(base_rand_.Uniform()); }
+
+long GlobalRand::ConvertToSeed(const double rand) const {
   long seed = (long)((rand - 0.5) * MAX_SEED);
   if (seed == 0) {
     seed = 0xdeadbeef;
   }
   return seed;
-}
\ No newline at end of file
+}
@@ -5,12 +5,16 @@
 
 #ifndef GLOBALRAND_HPP_
 #define GLOBALRAND_HPP_
-#include "./Ran0.hpp"
+#include <cstdint>
+
+#include "./PhiloxRand.hpp"
 
 /**
  * @class GlobalRand.h
  * @brief Class to manage global randomization
- * @note Used to make randomized seed for other randomization
+ * @note Used to make randomized seed for other randomization.
+ *       The seeds are taken from a counter-based stream keyed by the campaign seed and the case ID, so that the seeds of a case do not
+ *       depend on the other cases and a case can be re-executed alone with the identical results.
  */
 class GlobalRand {
  public:
@@ -24,18 +28,45 @@ class GlobalRand {
    * @brief Set randomized seed value
    */
   void SetSeed(long seed);
+  /**
+   * @fn SetCaseSeed
+   * @brief Set the seed of the campaign and the ID of the case executed on this thread
+   * @param [in] campaign_seed: Seed of the campaign
+   * @param [in] case_id: ID of the case
+   */
+  void SetCaseSeed(const uint64_t campaign_seed, const uint64_t case_id);
   /**
    * @fn MakeSeed
    * @brief Set randomized seed value
+   * @note The seed depends on the number of the previous calls in the case
    */
   long MakeSeed();
 
+  // Getter
+  /**
+   * @fn GetCampaignSeed
+   * @brief Return the seed of the campaign
+   */
+  inline uint64_t GetCampaignSeed() const { return campaign_seed_; }
+  /**
+   * @fn GetCaseId
+   * @brief Return the ID of the case
+   */
+  inline uint64_t GetCaseId() const { return case_id_; }
+
  private:
   static const unsigned int MAX_SEED = 0xffffffff;  //!< Maximum value of seed
-  libra::Ran0 base_rand_;                           //!< Base of global randomization
-  long seed_;                                       //!< Seed of global randomization
+  libra::PhiloxRand base_rand_;                     //!< Base of global randomization
+  uint64_t campaign_seed_;                          //!< Seed of the campaign
+  uint64_t case_id_;                                //!< ID of the case
+
+  /**
+   * @fn ConvertToSeed
+   * @brief Convert uniform random number to the seed value
+   */
+  long ConvertToSeed(const double rand) const;
 };
 
-extern GlobalRand g_rand;  //!< Global randomization
+extern thread_local GlobalRand g_rand;  //!< Global randomization. Each thread has its own sequence so that parallel cases are reproducible.
 
-#endif
\ No newline at end of file
+#endif
@@ -9,13 +9,51 @@ using libra::NormalRand;
 #include <cfloat>  //DBL_EPSILON
 #include <cmath>   //sqrt, log;
 
-NormalRand::NormalRand() : avg_(0.0), stddev_(1.0), holder_(0.0), is_empty_(true) {}
+std::atomic<bool> NormalRand::default_buffered_(false);
 
-NormalRand::NormalRand(double avg, double stddev) : avg_(avg), stddev_(stddev), holder_(0.0), is_empty_(true) {}
+NormalRand::NormalRand()
+    : avg_(0.0),
+      stddev_(1.0),
+      holder_(0.0),
+      is_empty_(true),
+      is_buffered_(default_buffered_),
+      buffered_rand_(0xdeadbeef),
+      buffer_index_(kBufferSize) {}
 
-NormalRand::NormalRand(double avg, double stddev, long seed) throw() : avg_(avg), stddev_(stddev), rand_(seed), holder_(0.0), is_empty_(true) {}
+NormalRand::NormalRand(double avg, double stddev)
+    : avg_(avg),
+      stddev_(stddev),
+      holder_(0.0),
+      is_empty_(true),
+      is_buffered_(default_buffered_),
+      buffered_rand_(0xdeadbeef),
+      buffer_index_(kBufferSize) {}
+
+NormalRand::NormalRand(double avg, double stddev, long seed) throw()
+    : avg_(avg),
+      stddev_(stddev),
+      rand_(seed),
+      holder_(0.0),
+      is_empty_(true),
+      is_buffered_(default_buffered_),
+      buffered_rand_((uint64_t)seed),
+      buffer_index_(kBufferSize) {}
+
+void NormalRand::set_default_buffered(bool buffered) { default_buffered_ = buffered; }
+
+bool NormalRand::default_buffered() { return default_buffered_; }
+
+void NormalRand::refill() {
+  buffered_rand_.fill_normal(buffer_, kBufferSize);
+  buffer_index_ = 0;
+}
 
 NormalRand::operator double() {
+  if (is_buffered_) {
+    if (buffer_index_ >= kBufferSize) refill();
+    return buffer_[buffer_index_++] * stddev_ + avg_;
+  }
+
   if (is_empty_) {
     double v1, v2, rsq;
     do {
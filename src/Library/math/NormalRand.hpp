@@ -6,7 +6,11 @@
 #ifndef NORMAL_RAND_HPP_
 #define NORMAL_RAND_HPP_
 
+#include <atomic>
+#include <cstddef>
+
 #include "Ran1.hpp"
+#include "Xoshiro256pp.hpp"
 using libra::Ran1;
 
 namespace libra {
@@ -14,6 +18,8 @@ namespace libra {
 /**
  * @class NormalRand
  * @brief Class to generate random value with normal distribution with Box-Muller method
+ * @note In the buffered mode, the values are generated with xoshiro256++ in blocks and taken from the buffer one by one.
+ *       The mode is decided at the construction with the default mode.
  */
 class NormalRand {
  public:
@@ -88,6 +94,23 @@ class NormalRand {
    */
   inline void set_param(double avg, double stddev, long seed);
 
+  /**
+   * @fn is_buffered
+   * @brief Return true when the buffered mode is used
+   */
+  inline bool is_buffered() const;
+  /**
+   * @fn set_default_buffered
+   * @brief Set the mode of the instances constructed after this call
+   * @param [in] buffered: Use the buffered mode or not
+   */
+  static void set_default_buffered(bool buffered);
+  /**
+   * @fn default_buffered
+   * @brief Return the mode of the instances constructed after this call
+   */
+  static bool default_buffered();
+
  private:
   double avg_;     //!< Average
   double stddev_;  //!< Standard deviation
@@ -96,6 +119,20 @@ class NormalRand {
                    //!< The second value is stored and used in the next call.
                    //!< It means that Box-Muller method is executed once per two call
   bool is_empty_;  //!< Flag to show the holder_ has available value
+
+  static const std::size_t kBufferSize = 64;  //!< Number of values generated at once in the buffered mode
+  bool is_buffered_;                          //!< Use the buffered mode
+  Xoshiro256pp buffered_rand_;                //!< Randomized origin of the buffered mode
+  double buffer_[kBufferSize];                //!< Generated values in the buffered mode
+  std::size_t buffer_index_;                  //!< Index of the next value in buffer_
+
+  static std::atomic<bool> default_buffered_;  //!< Mode of the instances constructed after now
+
+  /**
+   * @fn refill
+   * @brief Generate the values of the buffer
+   */
+  void refill();
 };
 
 }  // namespace libra
@@ -25,8 +25,13 @@ void NormalRand::set_param(double avg, double stddev, long seed) {
   avg_ = avg;
   stddev_ = stddev;
   rand_.init_seed(seed);
+  buffered_rand_.init((uint64_t)seed);
+  buffer_index_ = kBufferSize;
+  is_empty_ = true;
 }
 
+bool NormalRand::is_buffered() const { return is_buffered_; }
+
 }  // namespace libra
 
 #endif  // NORMAL_RAND_IFS_HPP_
@@ -0,0 +1,98 @@
+/**
+ * @file PhiloxRand.cpp
+ * @brief Counter-based randomization with Philox4x32-10
+ * @note Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC11, 2011
+ */
+
+#include "PhiloxRand.hpp"
+using libra::PhiloxRand;
+
+#include <cmath>
+
+#include "Constant.hpp"
+
+// Multipliers and Weyl sequence constants of Philox4x32
+static const uint32_t kPhiloxM0 = 0xD2511F53;
+static const uint32_t kPhiloxM1 = 0xCD9E8D57;
+static const uint32_t kPhiloxW0 = 0x9E3779B9;
+static const uint32_t kPhiloxW1 = 0xBB67AE85;
+
+/**
+ * @fn SplitMix64
+ * @brief Mix the 64bit value
+ */
+static uint64_t SplitMix64(uint64_t z) {
+  z += 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+PhiloxRand::PhiloxRand(const uint64_t key, const uint64_t stream_id) : counter_(0), buffer_index_(4), normal_holder_(0.0), is_normal_empty_(true) {
+  key_[0] = (uint32_t)key;
+  key_[1] = (uint32_t)(key >> 32);
+  stream_id_[0] = (uint32_t)stream_id;
+  stream_id_[1] = (uint32_t)(stream_id >> 32);
+}
+
+PhiloxRand::PhiloxRand(const uint64_t campaign_seed, const uint64_t case_id, const std::string& object_name, const uint64_t stream_id)
+    : PhiloxRand(MakeKey(campaign_seed, case_id, object_name), stream_id) {}
+
+uint64_t PhiloxRand::MakeKey(const uint64_t campaign_seed, const uint64_t case_id, const std::string& object_name) {
+  // FNV-1a hash of the name
+  uint64_t name_hash = 0xcbf29ce484222325ULL;
+  for (const char c : object_name) {
+    name_hash ^= (uint8_t)c;
+    name_hash *= 0x100000001b3ULL;
+  }
+  return SplitMix64(SplitMix64(SplitMix64(campaign_seed) ^ case_id) ^ name_hash);
+}
+
+void PhiloxRand::GenerateBlock(uint32_t block[4]) {
+  uint32_t c[4] = {(uint32_t)counter_, (uint32_t)(counter_ >> 32), stream_id_[0], stream_id_[1]};
+  uint32_t k[2] = {key_[0], key_[1]};
+  for (int round = 0; round < 10; round++) {
+    const uint64_t product0 = (uint64_t)kPhiloxM0 * c[0];
+    const uint64_t product1 = (uint64_t)kPhiloxM1 * c[2];
+    const uint32_t next[4] = {(uint32_t)(product1 >> 32) ^ c[1] ^ k[0], (uint32_t)product1, (uint32_t)(product0 >> 32) ^ c[3] ^ k[1],
+                              (uint32_t)product0};
+    for (int i = 0; i < 4; i++) c[i] = next[i];
+    k[0] += kPhiloxW0;
+    k[1] += kPhiloxW1;
+  }
+  for (int i = 0; i < 4; i++) block[i] = c[i];
+  counter_++;
+}
+
+void PhiloxRand::SetCounter(const uint64_t counter) {
+  counter_ = counter;
+  buffer_index_ = 4;
+  is_normal_empty_ = true;
+}
+
+uint32_t PhiloxRand::NextWord() {
+  if (buffer_index_ >= 4) {
+    GenerateBlock(buffer_);
+    buffer_index_ = 0;
+  }
+  return buffer_[buffer_index_++];
+}
+
+double PhiloxRand::Uniform() {
+  const uint64_t upper = NextWord() >> 5;  // 27bit
+  const uint64_t lower = NextWord() >> 6;  // 26bit
+  // Add 0.5 to exclude 0
+  return ((double)((upper << 26) | lower) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+double PhiloxRand::Normal() {
+  if (!is_normal_empty_) {
+    is_normal_empty_ = true;
+    return normal_holder_;
+  }
+  const double r = std::sqrt(-2.0 * std::log(Uniform()));
+  const double theta = libra::tau * Uniform();
+  normal_holder_ = r * std::sin(theta);
+  is_normal_empty_ = false;
+  return r * std::cos(theta);
+}
@@ -0,0 +1,98 @@
+/**
+ * @file PhiloxRand.hpp
+ * @brief Counter-based randomization with Philox4x32-10
+ * @note Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC11, 2011
+ */
+
+#ifndef PHILOX_RAND_HPP_
+#define PHILOX_RAND_HPP_
+
+#include <cstdint>
+#include <string>
+
+namespace libra {
+
+/**
+ * @class PhiloxRand
+ * @brief Counter-based randomization with Philox4x32-10
+ * @note The output is a pure function of the key and the counter. A stream is specified with the key, which is made from the campaign
+ *       seed, the case ID and the object name, and the stream ID. Any stream can be regenerated independently of the other streams,
+ *       and the streams can be used concurrently without shared state.
+ */
+class PhiloxRand {
+ public:
+  /**
+   * @fn PhiloxRand
+   * @brief Constructor
+   * @param [in] key: Key of the stream
+   * @param [in] stream_id: ID of the stream
+   */
+  explicit PhiloxRand(const uint64_t key = 0, const uint64_t stream_id = 0);
+  /**
+   * @fn PhiloxRand
+   * @brief Constructor of the stream for an object in a case
+   * @param [in] campaign_seed: Seed of the campaign
+   * @param [in] case_id: ID of the case
+   * @param [in] object_name: Name of the object
+   * @param [in] stream_id: ID of the stream in the object
+   */
+  PhiloxRand(const uint64_t campaign_seed, const uint64_t case_id, const std::string& object_name, const uint64_t stream_id);
+
+  /**
+   * @fn MakeKey
+   * @brief Make the key of the stream for an object in a case
+   * @param [in] campaign_seed: Seed of the campaign
+   * @param [in] case_id: ID of the case
+   * @param [in] object_name: Name of the object
+   * @return Key of the stream
+   */
+  static uint64_t MakeKey(const uint64_t campaign_seed, const uint64_t case_id, const std::string& object_name);
+
+  /**
+   * @fn GenerateBlock
+   * @brief Generate the 128bit block of the current counter and increment the counter
+   * @param [out] block: Generated block
+   */
+  void GenerateBlock(uint32_t block[4]);
+  /**
+   * @fn Uniform
+   * @brief Generate a uniform random number in (0, 1) with 53bit resolution
+   */
+  double Uniform();
+  /**
+   * @fn Normal
+   * @brief Generate a standard normal random number with Box-Muller method
+   */
+  double Normal();
+
+  /**
+   * @fn GetCounter
+   * @brief Return the counter of the next block
+   */
+  inline uint64_t GetCounter() const { return counter_; }
+  /**
+   * @fn SetCounter
+   * @brief Skip to the block of the counter
+   * @param [in] counter: Counter of the next block
+   */
+  void SetCounter(const uint64_t counter);
+
+ private:
+  uint32_t key_[2];        //!< Key
+  uint32_t stream_id_[2];  //!< Stream ID (upper half of the counter)
+  uint64_t counter_;       //!< Counter of the next block (lower half of the counter)
+  uint32_t buffer_[4];     //!< Current block
+  int buffer_index_;       //!< Index of the next word in the current block
+  double normal_holder_;   //!< The second output of Box-Muller method
+  bool is_normal_empty_;   //!< Is normal_holder_ used?
+
+  /**
+   * @fn NextWord
+   * @brief Return the next 32bit word of the stream
+   */
+  uint32_t NextWord();
+};
+
+}  // namespace libra
+
+#endif  // PHILOX_RAND_HPP_
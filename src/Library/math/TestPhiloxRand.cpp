@@ -0,0 +1,74 @@
+/**
+ * @file TestPhiloxRand.cpp
+ * @brief Test codes for PhiloxRand class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "PhiloxRand.hpp"
+
+namespace {
+/**
+ * @fn GenerateKnownAnswerBlock
+ * @brief Generate the block of Philox4x32-10 for the 128bit counter and the 64bit key
+ */
+void GenerateKnownAnswerBlock(const uint32_t counter[4], const uint32_t key[2], uint32_t block[4]) {
+  const uint64_t key64 = (uint64_t)key[1] << 32 | key[0];
+  const uint64_t stream_id = (uint64_t)counter[3] << 32 | counter[2];
+  libra::PhiloxRand rand(key64, stream_id);
+  rand.SetCounter((uint64_t)counter[1] << 32 | counter[0]);
+  rand.GenerateBlock(block);
+}
+}  // namespace
+
+// Known answer vectors of philox4x32_10 in kat_vectors of Random123
+TEST(PhiloxRand, KnownAnswerZero) {
+  const uint32_t counter[4] = {0x00000000, 0x00000000, 0x00000000, 0x00000000};
+  const uint32_t key[2] = {0x00000000, 0x00000000};
+  uint32_t block[4];
+  GenerateKnownAnswerBlock(counter, key, block);
+
+  EXPECT_EQ(0x6627e8d5u, block[0]);
+  EXPECT_EQ(0xe169c58du, block[1]);
+  EXPECT_EQ(0xbc57ac4cu, block[2]);
+  EXPECT_EQ(0x9b00dbd8u, block[3]);
+}
+
+TEST(PhiloxRand, KnownAnswerOnes) {
+  const uint32_t counter[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+  const uint32_t key[2] = {0xffffffff, 0xffffffff};
+  uint32_t block[4];
+  GenerateKnownAnswerBlock(counter, key, block);
+
+  EXPECT_EQ(0x408f276du, block[0]);
+  EXPECT_EQ(0x41c83b0eu, block[1]);
+  EXPECT_EQ(0xa20bc7c6u, block[2]);
+  EXPECT_EQ(0x6d5451fdu, block[3]);
+}
+
+TEST(PhiloxRand, KnownAnswerPi) {
+  const uint32_t counter[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+  const uint32_t key[2] = {0xa4093822, 0x299f31d0};
+  uint32_t block[4];
+  GenerateKnownAnswerBlock(counter, key, block);
+
+  EXPECT_EQ(0xd16cfe09u, block[0]);
+  EXPECT_EQ(0x94fdccebu, block[1]);
+  EXPECT_EQ(0x5001e420u, block[2]);
+  EXPECT_EQ(0x24126ea1u, block[3]);
+}
+
+TEST(PhiloxRand, CounterIncrement) {
+  libra::PhiloxRand rand(0x1234, 5);
+  uint32_t first[4], second[4], skipped[4];
+  rand.GenerateBlock(first);
+  rand.GenerateBlock(second);
+  EXPECT_EQ(2u, rand.GetCounter());
+
+  // The block is a pure function of the key and the counter
+  libra::PhiloxRand other(0x1234, 5);
+  other.SetCounter(1);
+  other.GenerateBlock(skipped);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(second[i], skipped[i]);
+  }
+}
@@ -0,0 +1,66 @@
+/**
+ * @file TestXoshiro256pp.cpp
+ * @brief Test codes for Xoshiro256pp class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Xoshiro256pp.hpp"
+
+// Output of the reference implementation xoshiro256plusplus.c for the state {1, 2, 3, 4}
+TEST(Xoshiro256pp, KnownAnswer) {
+  const uint64_t state[4] = {1, 2, 3, 4};
+  const uint64_t expected[10] = {41943041ULL,
+                                 58720359ULL,
+                                 3588806011781223ULL,
+                                 3591011842654386ULL,
+                                 9228616714210784205ULL,
+                                 9973669472204895162ULL,
+                                 14011001112246962877ULL,
+                                 12406186145184390807ULL,
+                                 15849039046786891736ULL,
+                                 10450023813501588000ULL};
+  libra::Xoshiro256pp rand;
+  rand.set_state(state);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(expected[i], rand.next());
+  }
+}
+
+TEST(Xoshiro256pp, UniformRange) {
+  const size_t num = 1000000;
+  std::vector<double> buffer(num);
+  libra::Xoshiro256pp rand(0x1234);
+  rand.fill_uniform(buffer.data(), num);
+
+  double sum = 0.0, min = 1.0, max = 0.0;
+  for (size_t i = 0; i < num; i++) {
+    sum += buffer[i];
+    min = std::min(min, buffer[i]);
+    max = std::max(max, buffer[i]);
+  }
+  // Strictly inside (0, 1)
+  EXPECT_LT(0.0, min);
+  EXPECT_GT(1.0, max);
+  EXPECT_NEAR(0.5, sum / num, 1e-3);
+}
+
+TEST(Xoshiro256pp, NormalMoments) {
+  const size_t num = 1000000;
+  std::vector<double> buffer(num);
+  libra::Xoshiro256pp rand(0x1234);
+  rand.fill_normal(buffer.data(), num);
+
+  double sum = 0.0, sum2 = 0.0;
+  for (size_t i = 0; i < num; i++) {
+    sum += buffer[i];
+    sum2 += buffer[i] * buffer[i];
+  }
+  const double mean = sum / num;
+  const double variance = sum2 / num - mean * mean;
+  // Standard errors are 1e-3 for the mean and 1.4e-3 for the variance
+  EXPECT_NEAR(0.0, mean, 5e-3);
+  EXPECT_NEAR(1.0, variance, 7e-3);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file Xoshiro256pp.cpp
+ * @brief Randomization with xoshiro256++ and bulk generation of uniform and normal random numbers
+ * @note Blackman and Vigna, "Scrambled Linear Pseudorandom Number Generators", ACM TOMS, 2021
+ *       Marsaglia and Tsang, "The Ziggurat Method for Generating Random Variables", Journal of Statistical Software, 2000
+ */
+
+#include "Xoshiro256pp.hpp"
+using libra::Xoshiro256pp;
+
+#include <cmath>
+#include <cstdlib>
+
+Xoshiro256pp::Xoshiro256pp(const uint64_t seed) { init(seed); }
+
+void Xoshiro256pp::init(const uint64_t seed) {
+  // SplitMix64 to make the state, which must not be all zero
+  uint64_t z = seed;
+  for (int i = 0; i < 4; i++) {
+    z += 0x9e3779b97f4a7c15ULL;
+    uint64_t x = z;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    state_[i] = x ^ (x >> 31);
+  }
+}
+
+void Xoshiro256pp::set_state(const uint64_t state[4]) {
+  for (int i = 0; i < 4; i++) {
+    state_[i] = state[i];
+  }
+}
+
+void Xoshiro256pp::fill_uniform(double* dst, const size_t num) {
+  // Upper 53bit. Add 0.5 to exclude 0.
+  const double scale = 1.0 / 9007199254740992.0;
+  for (size_t i = 0; i < num; i++) {
+    dst[i] = ((double)(next() >> 11) + 0.5) * scale;
+  }
+}
+
+/**
+ * @struct ZigguratTable
+ * @brief Tables of the Ziggurat method for the standard normal distribution with 128 layers
+ */
+struct ZigguratTable {
+  static constexpr double kR = 3.442619855899;       //!< Start of the tail
+  static constexpr double kV = 9.91256303526217e-3;  //!< Area of each layer
+  static constexpr double kScale = 2147483648.0;     //!< 2^31
+  uint32_t k[128];                                   //!< Thresholds for the quick acceptance
+  double w[128];                                     //!< Widths of the layers divided by 2^31
+  double f[128];                                     //!< Density at the edges of the layers
+
+  ZigguratTable() {
+    double dn = kR;
+    double tn = dn;
+    const double q = kV / std::exp(-0.5 * dn * dn);
+    k[0] = (uint32_t)((dn / q) * kScale);
+    k[1] = 0;
+    w[0] = q / kScale;
+    w[127] = dn / kScale;
+    f[0] = 1.0;
+    f[127] = std::exp(-0.5 * dn * dn);
+    for (int i = 126; i >= 1; i--) {
+      dn = std::sqrt(-2.0 * std::log(kV / dn + std::exp(-0.5 * dn * dn)));
+      k[i + 1] = (uint32_t)((dn / tn) * kScale);
+      tn = dn;
+      f[i] = std::exp(-0.5 * dn * dn);
+      w[i] = dn / kScale;
+    }
+  }
+};
+
+void Xoshiro256pp::fill_normal(double* dst, const size_t num) {
+  static const ZigguratTable table;
+  const double uniform_scale = 1.0 / 9007199254740992.0;
+  auto uniform = [&]() { return ((double)(next() >> 11) + 0.5) * uniform_scale; };
+
+  for (size_t i = 0; i < num; i++) {
+    while (true) {
+      // Upper 32bit as a signed value and the layer from the lower bits
+      const uint64_t bits = next();
+      const int32_t hz = (int32_t)(bits >> 32);
+      const int iz = (int)(bits & 127);
+      const double x = hz * table.w[iz];
+      // Inside the rectangle (about 99% of the cases)
+      if ((uint32_t)std::abs((int64_t)hz) < table.k[iz]) {
+        dst[i] = x;
+        break;
+      }
+      if (iz == 0) {
+        // Tail
+        double tail_x, tail_y;
+        do {
+          tail_x = -std::log(uniform()) / ZigguratTable::kR;
+          tail_y = -std::log(uniform());
+        } while (tail_y + tail_y < tail_x * tail_x);
+        dst[i] = hz > 0 ? ZigguratTable::kR + tail_x : -ZigguratTable::kR - tail_x;
+        break;
+      }
+      // Wedge
+      if (table.f[iz] + uniform() * (table.f[iz - 1] - table.f[iz]) < std::exp(-0.5 * x * x)) {
+        dst[i] = x;
+        break;
+      }
+    }
+  }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file Xoshiro256pp.hpp
+ * @brief Randomization with xoshiro256++ and bulk generation of uniform and normal random numbers
+ * @note Blackman and Vigna, "Scrambled Linear Pseudorandom Number Generators", ACM TOMS, 2021
+ *       Marsaglia and Tsang, "The Ziggurat Method for Generating Random Variables", Journal of Statistical Software, 2000
+ */
+
+#ifndef XOSHIRO256PP_HPP_
+#define XOSHIRO256PP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libra {
+
+/**
+ * @class Xoshiro256pp
+ * @brief Randomization with xoshiro256++ and bulk generation of uniform and normal random numbers
+ * @note The bulk functions fill a buffer at once to keep the generator state and the tables in registers and cache.
+ *       Normal random numbers are generated with the Ziggurat method, which needs one 64bit integer and a multiplication in most cases.
+ */
+class Xoshiro256pp {
+ public:
+  /**
+   * @fn Xoshiro256pp
+   * @brief Constructor
+   * @param [in] seed: Seed of randomization. The 256bit state is made from the seed with SplitMix64.
+   */
+  explicit Xoshiro256pp(const uint64_t seed = 0);
+
+  /**
+   * @fn init
+   * @brief Set seed value
+   * @param [in] seed: Seed of randomization
+   */
+  void init(const uint64_t seed);
+  /**
+   * @fn set_state
+   * @brief Set the 256bit state directly, e.g. to reproduce the reference sequence
+   * @param [in] state: State of the generator, which must not be all zero
+   */
+  void set_state(const uint64_t state[4]);
+
+  /**
+   * @fn next
+   * @brief Generate 64bit random integer
+   */
+  inline uint64_t next();
+
+  /**
+   * @fn fill_uniform
+   * @brief Fill the buffer with uniform random numbers in (0, 1)
+   * @param [out] dst: Buffer
+   * @param [in] num: Number of elements
+   */
+  void fill_uniform(double* dst, const size_t num);
+  /**
+   * @fn fill_normal
+   * @brief Fill the buffer with standard normal random numbers with the Ziggurat method
+   * @param [out] dst: Buffer
+   * @param [in] num: Number of elements
+   */
+  void fill_normal(double* dst, const size_t num);
+
+ private:
+  uint64_t state_[4];  //!< State of the generator
+
+  /**
+   * @fn rotl
+   * @brief Rotate left
+   */
+  static inline uint64_t rotl(const uint64_t x, const int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+uint64_t Xoshiro256pp::next() {
+  const uint64_t result = rotl(state_[0] + state_[3], 23) + state_[0];
+  const uint64_t t = state_[1] << 17;
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+  state_[2] ^= t;
+  state_[3] = rotl(state_[3], 45);
+  return result;
+}
+
+}  // namespace libra
+
+#endif  // XOSHIRO256PP_HPP_
@@ -17,6 +17,7 @@ extern "C" {
 #include <algorithm>
 #include <cctype>
 #include <cmath> /* maths functions */
+#include <mutex>
 #include <numeric>
 
 #include "Wrapper_nrlmsise00.h" /* header for nrlmsise-00.h */
@@ -27,7 +28,7 @@ using namespace std;
 /* ------------------------------ DEFINES ---------------------------- */
 /* ------------------------------------------------------------------- */
 
-static double decyear_monthly;
+static std::mutex gtd7_mutex; /* gtd7 uses global variables and is not reentrant */
 
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
@@ -162,34 +163,193 @@ int ConvertMonthStrToMonthNum(string month_str) {
   }
 }
 
+/**
+ * @fn DaysFromCivil
+ * @brief Return the number of days from 1970/01/01 to the date
+ * @note Ref: H. Hinnant, "chrono-Compatible Low-Level Date Algorithms"
+ */
+static int DaysFromCivil(int year, const int month, const int day) {
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int year_of_era = year - era * 400;
+  const int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+/**
+ * @fn CivilFromDays
+ * @brief Return the date of the number of days from 1970/01/01
+ */
+static void CivilFromDays(int days, int& year, int& month, int& day) {
+  days += 719468;
+  const int era = (days >= 0 ? days : days - 146096) / 146097;
+  const int day_of_era = days - era * 146097;
+  const int year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const int day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const int mp = (5 * day_of_year + 2) / 153;
+  day = day_of_year - (153 * mp + 2) / 5 + 1;
+  month = mp < 10 ? mp + 3 : mp - 9;
+  year = year_of_era + era * 400 + (month <= 2);
+}
+
+/**
+ * @fn ConvertDecyearToDayOfYear
+ * @brief Convert the decimal year to the day of the year as the inverse of JdToDecyear
+ * @note JdToDecyear divides the day of the year (1.0 at 00:00 of January 1st) by 365.25, so the decimal year of December 31st can exceed
+ *       the next integer. Such a decimal year belongs to the previous year, and the day is clamped to the last day of the year.
+ *       The last 18 hours of a leap year have the same decimal years as the first hours of the next year, and they are treated as the
+ *       next year.
+ * @param [in] decyear: Decimal year [year]
+ * @param [out] year: Year
+ * @param [out] day_of_year: Day of the year (1 for January 1st)
+ * @param [out] day_fraction: Fraction of the day, which is the universal time of the day divided by 86400 s
+ */
+static void ConvertDecyearToDayOfYear(const double decyear, int& year, int& day_of_year, double& day_fraction) {
+  // The small offset absorbs the rounding error of the decimal year at midnight
+  year = (int)floor(decyear);
+  double days = (decyear - year) * 365.25 + 1.0e-8;
+  if (days < 1.0) {
+    year--;
+    days += 365.25;
+  }
+  day_of_year = (int)floor(days);
+  day_fraction = days - day_of_year;
+  const int days_per_year = LeapYear(year) ? 366 : 365;
+  if (day_of_year > days_per_year) {
+    day_of_year = days_per_year;
+    day_fraction = 1.0 - 1.0e-8;
+  }
+}
+
+/* ------------------------------------------------------------------- */
+/* -------------------------SpaceWeatherTable------------------------- */
+/* ------------------------------------------------------------------- */
+map<tuple<string, double, double, bool>, shared_ptr<const SpaceWeatherTable>> SpaceWeatherTable::loaded_;
+mutex SpaceWeatherTable::loaded_mutex_;
+
+shared_ptr<const SpaceWeatherTable> SpaceWeatherTable::Load(const string& filename, const double decyear, const double endsec,
+                                                            const bool is_interpolated) {
+  lock_guard<mutex> lock(loaded_mutex_);
+  const auto key = make_tuple(filename, decyear, endsec, is_interpolated);
+  auto itr = loaded_.find(key);
+  if (itr != loaded_.end()) return itr->second;
+
+  auto table = make_shared<SpaceWeatherTable>();
+  table->SetInterpolation(is_interpolated);
+  GetSpaceWeatherTable_(decyear, endsec, filename, *table);
+  loaded_[key] = table;
+  return table;
+}
+
+void SpaceWeatherTable::AddRow(const nrlmsise_table& row) { rows_.push_back(row); }
+
+void SpaceWeatherTable::BuildIndex() {
+  day_index_.clear();
+  month_index_.clear();
+  if (rows_.empty()) return;
+
+  int last_day = 0, last_month = 0;
+  for (size_t i = 0; i < rows_.size(); i++) {
+    const int day = DaysFromCivil(rows_[i].year, rows_[i].month, rows_[i].day);
+    const int month = rows_[i].year * 12 + rows_[i].month - 1;
+    if (i == 0 || day < first_day_) first_day_ = day;
+    if (i == 0 || day > last_day) last_day = day;
+    if (i == 0 || month < first_month_) first_month_ = month;
+    if (i == 0 || month > last_month) last_month = month;
+  }
+
+  // The first row of the date or the month is used, same as the linear search
+  day_index_.assign(last_day - first_day_ + 1, -1);
+  month_index_.assign(last_month - first_month_ + 1, -1);
+  for (size_t i = 0; i < rows_.size(); i++) {
+    int& day_row = day_index_[DaysFromCivil(rows_[i].year, rows_[i].month, rows_[i].day) - first_day_];
+    if (day_row < 0) day_row = (int)i;
+    int& month_row = month_index_[rows_[i].year * 12 + rows_[i].month - 1 - first_month_];
+    if (month_row < 0) month_row = (int)i;
+  }
+}
+
+int SpaceWeatherTable::FindRow(const vector<int>& index, const int first, const int number) {
+  const int i = number - first;
+  if (i < 0 || i >= (int)index.size()) return -1;
+  return index[i];
+}
+
+void SpaceWeatherTable::GetParameters(const double decyear, double& f107, double& f107a, double& ap) const {
+  int year, day_of_year;
+  double day_fraction;
+  ConvertDecyearToDayOfYear(decyear, year, day_of_year, day_fraction);
+  const int day = DaysFromCivil(year, 1, 1) + day_of_year - 1;
+
+  int row, next_row;
+  double ratio;
+  if (decyear < monthly_start_decyear_) {
+    row = FindRow(day_index_, first_day_, day);
+    next_row = FindRow(day_index_, first_day_, day + 1);
+    ratio = day_fraction;
+  } else {
+    int y, m, d;
+    CivilFromDays(day, y, m, d);
+    const int month = y * 12 + m - 1;
+    row = FindRow(month_index_, first_month_, month);
+    next_row = FindRow(month_index_, first_month_, month + 1);
+    const int days_in_month = DaysFromCivil(m == 12 ? y + 1 : y, m == 12 ? 1 : m + 1, 1) - DaysFromCivil(y, m, 1);
+    ratio = (d - 1 + day_fraction) / days_in_month;
+  }
+  // The first row is used when no row is found, same as the linear search
+  if (row < 0) row = 0;
+
+  const nrlmsise_table& row_data = rows_[row];
+  f107 = row_data.F107_adj;
+  f107a = row_data.Ctr81_adj;
+  ap = row_data.Ap_avg;
+  if (is_interpolated_ && next_row >= 0 && next_row != row) {
+    const nrlmsise_table& next_data = rows_[next_row];
+    f107 += (next_data.F107_adj - f107) * ratio;
+    f107a += (next_data.Ctr81_adj - f107a) * ratio;
+    ap += (next_data.Ap_avg - ap) * ratio;
+  }
+}
+
 /* ------------------------------------------------------------------- */
 /* --------------------------CalcNRLMSISE00--------------------------- */
 /* ------------------------------------------------------------------- */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
+double CalcNRLMSISE00UtSec(double decyear) {
+  int year, day_of_year;
+  double day_fraction;
+  ConvertDecyearToDayOfYear(decyear, year, day_of_year, day_fraction);
+  return day_fraction * 86400.0;
+}
+
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const SpaceWeatherTable& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap) {
+  double density;
+  CalcNRLMSISE00(decyear, &latrad, &lonrad, &alt, 1, table, is_manual_param, manual_f107, manual_f107a, manual_ap, &density);
+  return density;
+}
+
+void CalcNRLMSISE00(double decyear, const double* latrad, const double* lonrad, const double* alt, size_t num, const SpaceWeatherTable& table,
+                    bool is_manual_param, double manual_f107, double manual_f107a, double manual_ap, double* densities) {
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
   struct ap_array aph;
 
   size_t i;
-  int date[6];
-  int idx = 0;
 
   /* input values */
   for (i = 0; i < 24; i++) {
     flags.switches[i] = 1;
   }
 
-  ConvertDecyearToDate(decyear, date);
-
-  input.doy = (int)((decyear - (int)decyear) * 365.25);
+  // Same conversion as the space weather table
+  int year, day_of_year;
+  double day_fraction;
+  ConvertDecyearToDayOfYear(decyear, year, day_of_year, day_fraction);
+  input.doy = day_of_year;
   input.year = 0; /* without effect */
-  input.sec = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
-  input.alt = alt / 1000.0;
-  input.g_lat = latrad * libra::rad_to_deg;
-  input.g_long = lonrad * libra::rad_to_deg;
-  input.lst = input.sec / 3600.0 + lonrad * libra::rad_to_deg / 15.0;
+  input.sec = day_fraction * 86400.0;
 
   if (is_manual_param) {
     input.f107 = manual_f107;
@@ -199,29 +359,11 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
     // f10.7 and ap from table
     // If the table size is zero, return 0
     if (table.size() == 0) {
-      return 0.0;
+      fill(densities, densities + num, 0.0);
+      return;
     }
 
-    // search table index
-    for (i = 0; i < table.size(); i++) {
-      if (decyear < decyear_monthly) {
-        // Match year, month, date
-        if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) {
-          idx = i;
-          break;
-        }
-      } else {
-        // Match year, month
-        if ((date[0] == table[i].year) && (date[1] == table[i].month)) {
-          idx = i;
-          break;
-        }
-      }
-    }
-
-    input.f107A = table[idx].Ctr81_adj;
-    input.f107 = table[idx].F107_adj;
-    input.ap = table[idx].Ap_avg;
+    table.GetParameters(decyear, input.f107, input.f107A, input.ap);
   }
 
   for (i = 0; i < 7; i++) {
@@ -229,14 +371,23 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
   }
   input.ap_a = &aph;
 
-  gtd7(&input, &flags, &output);
-  return output.d[5];
+  {
+    lock_guard<mutex> lock(gtd7_mutex);
+    for (i = 0; i < num; i++) {
+      input.alt = alt[i] / 1000.0;
+      input.g_lat = latrad[i] * libra::rad_to_deg;
+      input.g_long = lonrad[i] * libra::rad_to_deg;
+      input.lst = input.sec / 3600.0 + lonrad[i] * libra::rad_to_deg / 15.0;
+      gtd7(&input, &flags, &output);
+      densities[i] = output.d[5];
+    }
+  }
 }
 
 /* ------------------------------------------------------------------- */
 /* -----------------------ReadSpaceWeatherTable----------------------- */
 /* ------------------------------------------------------------------- */
-int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, vector<nrlmsise_table>& table) {
+int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, SpaceWeatherTable& table) {
   ifstream ifs(filename);
 
   if (!ifs.is_open()) {
@@ -273,7 +424,7 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
 
         // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
         int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-        decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
+        table.SetMonthlyStartDecyear(decyear_updated + (days_month[month_updated % 12] + 14) / 365.0);
       }
       continue;
     }
@@ -300,8 +451,9 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
     line_data.Ctr81_obs = atof(line.substr(119, 5).c_str());
     line_data.Lst81_obs = atof(line.substr(125, 5).c_str());
 
-    table.push_back(line_data);
+    table.AddRow(line_data);
   }
+  table.BuildIndex();
 
   return table.size();
 }
@@ -9,8 +9,12 @@
 
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 /**
@@ -31,6 +35,103 @@ struct nrlmsise_table {
   double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
 };
 
+/**
+ * @class SpaceWeatherTable
+ * @brief Space weather table with the direct lookup by day and month
+ * @note The index from the day and the month to the table row is made when the table is loaded, and the lookup is O(1).
+ *       Before the start of the monthly prediction, the row of the day is used. After that, the first row of the month is used.
+ */
+class SpaceWeatherTable {
+ public:
+  /**
+   * @fn Load
+   * @brief Return the table read from the space weather file
+   * @note The file is read only once per process for each setting and the table is shared between all callers
+   * @param [in] filename: Path to the space weather file
+   * @param [in] decyear: Decimal year of the simulation start time
+   * @param [in] endsec: Simulation duration [sec]
+   * @param [in] is_interpolated: Flag to interpolate the parameters
+   */
+  static std::shared_ptr<const SpaceWeatherTable> Load(const std::string& filename, const double decyear, const double endsec,
+                                                       const bool is_interpolated);
+
+  /**
+   * @fn AddRow
+   * @brief Add a row of the table. BuildIndex should be called after all rows are added.
+   * @param [in] row: Table row
+   */
+  void AddRow(const nrlmsise_table& row);
+  /**
+   * @fn SetMonthlyStartDecyear
+   * @brief Set the start of the monthly prediction
+   * @param [in] decyear: Decimal year of the start of the monthly prediction
+   */
+  inline void SetMonthlyStartDecyear(const double decyear) { monthly_start_decyear_ = decyear; }
+  /**
+   * @fn SetInterpolation
+   * @brief Set the flag to interpolate the parameters linearly between the days (or the months in the monthly prediction)
+   * @param [in] is_interpolated: Flag of the interpolation
+   */
+  inline void SetInterpolation(const bool is_interpolated) { is_interpolated_ = is_interpolated; }
+  /**
+   * @fn BuildIndex
+   * @brief Make the index from the day and the month to the table row
+   */
+  void BuildIndex();
+
+  /**
+   * @fn GetParameters
+   * @brief Return the F10.7 and Ap parameters at the time
+   * @param [in] decyear: Decimal year
+   * @param [out] f107: Daily F10.7 (adjusted)
+   * @param [out] f107a: Centered 81-day average of F10.7 (adjusted)
+   * @param [out] ap: Daily average of Ap-index
+   */
+  void GetParameters(const double decyear, double& f107, double& f107a, double& ap) const;
+
+  /**
+   * @fn size
+   * @brief Return number of the table rows
+   */
+  inline size_t size() const { return rows_.size(); }
+  /**
+   * @fn GetRows
+   * @brief Return the table rows
+   */
+  inline const std::vector<nrlmsise_table>& GetRows() const { return rows_; }
+
+ private:
+  std::vector<nrlmsise_table> rows_;    //!< Table rows
+  double monthly_start_decyear_ = 0.0;  //!< Decimal year of the start of the monthly prediction
+  bool is_interpolated_ = false;        //!< Flag to interpolate the parameters
+  int first_day_ = 0;                   //!< Day number of day_index_[0]
+  std::vector<int> day_index_;          //!< Index from the day number to the first row of the date (-1 for no data)
+  int first_month_ = 0;                 //!< Month number of month_index_[0]
+  std::vector<int> month_index_;        //!< Index from the month number (year * 12 + month - 1) to the first row of the month
+
+  static std::map<std::tuple<std::string, double, double, bool>, std::shared_ptr<const SpaceWeatherTable>> loaded_;  //!< Loaded tables
+  static std::mutex loaded_mutex_;                                                                                  //!< Mutex for loaded_
+
+  /**
+   * @fn FindRow
+   * @brief Return the row index of the day or the month
+   * @param [in] index: Index vector
+   * @param [in] first: Number of the first element of the index
+   * @param [in] number: Day or month number
+   * @return Row index, or -1 when no row is found
+   */
+  static int FindRow(const std::vector<int>& index, const int first, const int number);
+};
+
+/**
+ * @fn CalcNRLMSISE00UtSec
+ * @brief Return the universal time of the day used in CalcNRLMSISE00
+ * @note The local solar time in the model is this time plus longitude / 15 [hour]
+ * @param [in] decyear: Decimal year
+ * @return Seconds from the beginning of the day [s]
+ */
+double CalcNRLMSISE00UtSec(double decyear);
+
 /**
  * @fn CalcNRLMSISE00
  * @brief Read the space weather table file
@@ -45,8 +146,26 @@ struct nrlmsise_table {
  * @param [in] manual_ap: Manual setting Ap-index
  * @return Atmospheric density [kg/m3]
  */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const SpaceWeatherTable& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap);
+/**
+ * @fn CalcNRLMSISE00
+ * @brief Calculate atmospheric densities of multiple positions at the same time
+ * @note The space weather parameters are looked up once, and the model is called for all positions in a single lock of the model
+ * @param [in] decyear: Decimal year
+ * @param [in] latrad: Latitudes [rad]
+ * @param [in] lonrad: Longitudes [rad]
+ * @param [in] alt: Altitudes [m]
+ * @param [in] num: Number of positions
+ * @param [in] table: Space Weather table
+ * @param [in] is_manual_param: Flag to use manual parameters
+ * @param [in] manual_f107: Manual setting F10.7
+ * @param [in] manual_f107a: Manual setting averaged F10.7
+ * @param [in] manual_ap: Manual setting Ap-index
+ * @param [out] densities: Atmospheric densities [kg/m3]
+ */
+void CalcNRLMSISE00(double decyear, const double* latrad, const double* lonrad, const double* alt, size_t num, const SpaceWeatherTable& table,
+                    bool is_manual_param, double manual_f107, double manual_f107a, double manual_ap, double* densities);
 
 /**
  * @fn GetSpaceWeatherTable_
@@ -57,7 +176,7 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
  * @param [out] table: Space weather table
  * @return Size of table
  */
-int GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::vector<nrlmsise_table>& table);
+int GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, SpaceWeatherTable& table);
 
 /* ------------------------------------------------------------------- */
 /* ----------------------- COMPILATION TWEAKS ------------------------ */
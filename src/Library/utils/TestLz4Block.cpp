@@ -0,0 +1,72 @@
+/**
+ * @file TestLz4Block.cpp
+ * @brief Test codes for the LZ4 block compression with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "lz4_block.h"
+
+namespace {
+/**
+ * @fn RoundTrip
+ * @brief Compress and decompress the data, and return the size of the block
+ */
+size_t RoundTrip(const std::string& raw, const int level) {
+  std::string block("prefix");  // The block is appended to the output
+  const size_t block_size = compress_lz4_block(raw.data(), raw.size(), block, level);
+  EXPECT_EQ(block.size(), block_size + 6);
+  EXPECT_EQ("prefix", block.substr(0, 6));
+
+  std::string decompressed(raw.size(), '\0');
+  EXPECT_TRUE(decompress_lz4_block(block.data() + 6, block_size, &decompressed[0], raw.size()));
+  EXPECT_EQ(raw, decompressed);
+  return block_size;
+}
+}  // namespace
+
+class Lz4Block : public ::testing::TestWithParam<int> {};
+
+TEST_P(Lz4Block, Empty) {
+  // A token without literals and match
+  EXPECT_EQ(1u, RoundTrip("", GetParam()));
+}
+
+TEST_P(Lz4Block, ShortInput) {
+  // Shorter than 13 bytes, which is written only as literals
+  for (size_t size = 1; size < 13; size++) {
+    const std::string raw(size, 'a');
+    EXPECT_EQ(size + 1, RoundTrip(raw, GetParam()));
+  }
+}
+
+TEST_P(Lz4Block, RepetitiveInput) {
+  std::string raw;
+  for (int i = 0; i < 10000; i++) {
+    raw += "time,position_x,position_y,position_z," + std::to_string(i % 7) + "\n";
+  }
+  EXPECT_GT(raw.size() / 10, RoundTrip(raw, GetParam()));
+}
+
+TEST_P(Lz4Block, RandomInput) {
+  std::mt19937_64 engine(1);
+  std::string raw(100000, '\0');
+  for (auto& c : raw) c = (char)(engine() & 0xff);
+  // Not compressed, so that CompressedLogStreamBuf stores the block as it is
+  EXPECT_LE(raw.size(), RoundTrip(raw, GetParam()));
+}
+
+TEST_P(Lz4Block, CorruptedBlock) {
+  const std::string raw(1000, 'a');
+  std::string block;
+  const size_t block_size = compress_lz4_block(raw.data(), raw.size(), block, GetParam());
+  std::string decompressed(raw.size(), '\0');
+  // Wrong size of the decompressed data
+  EXPECT_FALSE(decompress_lz4_block(block.data(), block_size, &decompressed[0], raw.size() - 1));
+  // Truncated block
+  EXPECT_FALSE(decompress_lz4_block(block.data(), block_size - 1, &decompressed[0], raw.size()));
+}
+
+INSTANTIATE_TEST_SUITE_P(Level, Lz4Block, ::testing::Values(1, 9));
@@ -0,0 +1,166 @@
+/**
+ * @file lz4_block.cpp
+ * @brief Functions for LZ4 block compression
+ */
+
+#include "lz4_block.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+static const size_t kMinMatch = 4;         //!< Minimum length of a match
+static const size_t kLastLiterals = 5;     //!< The last bytes must be literals
+static const size_t kMatchFindLimit = 12;  //!< A match must start before the last 12 bytes
+static const size_t kMaxDistance = 65535;  //!< Maximum offset of a match
+static const int kHashLog = 16;            //!< Size of the hash table (log2)
+
+static inline uint32_t read32(const char* p) {
+  uint32_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+static inline uint32_t hash32(const uint32_t value) { return (value * 2654435761U) >> (32 - kHashLog); }
+
+/**
+ * @fn append_length
+ * @brief Append the remaining length after the 4 bits in the token
+ */
+static void append_length(std::string& dst, size_t length) {
+  while (length >= 255) {
+    dst.push_back((char)255);
+    length -= 255;
+  }
+  dst.push_back((char)length);
+}
+
+/**
+ * @fn append_sequence
+ * @brief Append the literals and the match. The match is omitted when match_length is zero.
+ */
+static void append_sequence(std::string& dst, const char* literals, const size_t literal_length, const size_t offset, const size_t match_length) {
+  const size_t token_pos = dst.size();
+  dst.push_back(0);
+  uint8_t token = (uint8_t)((literal_length >= 15 ? 15 : literal_length) << 4);
+  if (literal_length >= 15) append_length(dst, literal_length - 15);
+  dst.append(literals, literal_length);
+  if (match_length > 0) {
+    dst.push_back((char)(offset & 0xff));
+    dst.push_back((char)(offset >> 8));
+    const size_t length = match_length - kMinMatch;
+    token |= (uint8_t)(length >= 15 ? 15 : length);
+    if (length >= 15) append_length(dst, length - 15);
+  }
+  dst[token_pos] = (char)token;
+}
+
+size_t compress_lz4_block(const char* src, const size_t size, std::string& dst, const int level) {
+  const size_t start_size = dst.size();
+  if (size < kMatchFindLimit + 1) {
+    append_sequence(dst, src, size, 0, 0);
+    return dst.size() - start_size;
+  }
+
+  const int max_attempts = level <= 1 ? 1 : 1 << ((level > 9 ? 9 : level) - 1);
+  // Latest position of each hash and the previous position with the same hash. The positions are stored with the offset of each call,
+  // so that the table is not cleared and the positions of the former calls are ignored.
+  static thread_local std::vector<uint32_t> head;
+  static thread_local std::vector<uint32_t> chain;
+  static thread_local uint32_t base = 0;
+  if (head.empty() || (uint64_t)base + size + 1 >= 0x80000000ULL) {
+    head.assign((size_t)1 << kHashLog, 0);
+    base = 0;
+  }
+  base += 1;  // Zero in the table means no position
+  if (max_attempts > 1 && chain.size() < size) chain.resize(size);
+  // Local pointers to avoid the access to the thread local storage in the loop
+  uint32_t* const head_table = head.data();
+  uint32_t* const chain_table = chain.data();
+  const uint32_t offset = base;
+
+  const size_t match_start_limit = size - kMatchFindLimit;
+  const size_t match_end_limit = size - kLastLiterals;
+  auto insert = [&](const size_t pos) {
+    const uint32_t h = hash32(read32(src + pos));
+    if (max_attempts > 1) chain_table[pos] = head_table[h];
+    head_table[h] = offset + (uint32_t)pos;
+  };
+
+  size_t pos = 0;
+  size_t anchor = 0;
+  size_t num_of_misses = 0;
+  while (pos <= match_start_limit) {
+    const uint32_t sequence = read32(src + pos);
+    uint32_t candidate = head_table[hash32(sequence)];
+    size_t best_length = 0;
+    size_t best_pos = 0;
+    for (int attempt = 0; attempt < max_attempts && candidate >= offset && pos - (candidate - offset) <= kMaxDistance; attempt++) {
+      const size_t candidate_pos = candidate - offset;
+      if (read32(src + candidate_pos) == sequence) {
+        size_t length = kMinMatch;
+        while (pos + length < match_end_limit && src[candidate_pos + length] == src[pos + length]) length++;
+        if (length > best_length) {
+          best_length = length;
+          best_pos = candidate_pos;
+        }
+      }
+      candidate = max_attempts > 1 ? chain_table[candidate_pos] : 0;
+    }
+    insert(pos);
+
+    if (best_length < kMinMatch) {
+      // Skip faster in the data which is not compressed (level 1 only)
+      pos += max_attempts > 1 ? 1 : 1 + (num_of_misses++ >> 6);
+      continue;
+    }
+    num_of_misses = 0;
+    append_sequence(dst, src + anchor, pos - anchor, pos - best_pos, best_length);
+    // Register the positions in the match to find the later matches. Only the last one in level 1.
+    const size_t match_end = pos + best_length;
+    for (pos = max_attempts > 1 ? pos + 1 : match_end - 2; pos < match_end && pos <= match_start_limit; pos++) insert(pos);
+    pos = match_end;
+    anchor = pos;
+  }
+  base += (uint32_t)size;
+  append_sequence(dst, src + anchor, size - anchor, 0, 0);
+  return dst.size() - start_size;
+}
+
+bool decompress_lz4_block(const char* src, const size_t size, char* dst, const size_t raw_size) {
+  const uint8_t* in = (const uint8_t*)src;
+  const uint8_t* in_end = in + size;
+  size_t out = 0;
+
+  auto read_length = [&](size_t length) -> size_t {
+    if (length != 15) return length;
+    while (in < in_end) {
+      const uint8_t byte = *in++;
+      length += byte;
+      if (byte != 255) break;
+    }
+    return length;
+  };
+
+  while (in < in_end) {
+    const uint8_t token = *in++;
+    const size_t literal_length = read_length(token >> 4);
+    if ((size_t)(in_end - in) < literal_length || raw_size - out < literal_length) return false;
+    memcpy(dst + out, in, literal_length);
+    in += literal_length;
+    out += literal_length;
+    if (in == in_end) break;  // The last sequence has no match
+
+    if (in_end - in < 2) return false;
+    const size_t offset = (size_t)in[0] | ((size_t)in[1] << 8);
+    in += 2;
+    const size_t match_length = read_length(token & 0x0f) + kMinMatch;
+    if (offset == 0 || offset > out || raw_size - out < match_length) return false;
+    // Byte by byte since the match can overlap the output
+    const char* match = dst + out - offset;
+    for (size_t i = 0; i < match_length; i++) dst[out + i] = match[i];
+    out += match_length;
+  }
+  return out == raw_size;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file lz4_block.h
+ * @brief Functions for LZ4 block compression
+ * @note The output is the LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md), so that it can be
+ *       decompressed with the LZ4 library as well.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <string>
+
+/**
+ * @fn compress_lz4_block
+ * @brief Compress data into a LZ4 block
+ * @param [in] src: Input data
+ * @param [in] size: Size of the input data [byte]
+ * @param [out] dst: Output. The block is appended.
+ * @param [in] level: Compression level from 1 (fastest) to 9 (smallest). The number of the candidates searched for each match is
+ *                    2^(level-1).
+ * @return Size of the block [byte]
+ */
+size_t compress_lz4_block(const char* src, const size_t size, std::string& dst, const int level = 1);
+
+/**
+ * @fn decompress_lz4_block
+ * @brief Decompress a LZ4 block
+ * @param [in] src: Block
+ * @param [in] size: Size of the block [byte]
+ * @param [out] dst: Output buffer
+ * @param [in] raw_size: Size of the decompressed data [byte]
+ * @return True when the block is decompressed to raw_size bytes without error
+ */
+bool decompress_lz4_block(const char* src, const size_t size, char* dst, const size_t raw_size);
@@ -39,52 +39,47 @@ void RelativeInformation::RemoveDynamicsInfo(const int sat_id) {
   ResizeLists();
 }
 
-std::string RelativeInformation::GetLogHeader() const {
-  std::string str_tmp = "";
+void RelativeInformation::GetLogSchema(LogSchema& schema) const {
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "i", "m", 3);
+      schema.AddVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "i", "m", 3);
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector("sat" + std::to_string(target_sat_id) + " velocity from sat" + std::to_string(reference_sat_id), "i", "m", 3);
+      schema.AddVector("sat" + std::to_string(target_sat_id) + " velocity from sat" + std::to_string(reference_sat_id), "i", "m", 3);
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "rtn", "m", 3);
+      schema.AddVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "rtn", "m", 3);
     }
   }
-  return str_tmp;
 }
 
-std::string RelativeInformation::GetLogValue() const {
-  std::string str_tmp = "";
+void RelativeInformation::LogValues(LogSink& sink) const {
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector(GetRelativePosition_i_m(target_sat_id, reference_sat_id));
+      sink.Add(GetRelativePosition_i_m(target_sat_id, reference_sat_id));
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_i_m_s(target_sat_id, reference_sat_id));
+      sink.Add(GetRelativeVelocity_i_m_s(target_sat_id, reference_sat_id));
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector(GetRelativePosition_rtn_m(target_sat_id, reference_sat_id));
+      sink.Add(GetRelativePosition_rtn_m(target_sat_id, reference_sat_id));
     }
   }
-
-  return str_tmp;
 }
 
-void RelativeInformation::LogSetup(Logger& logger) { logger.AddLoggable(this); }
+void RelativeInformation::LogSetup(Logger& logger) { logger.AddLoggable(this, "relative_information"); }
 
 libra::Quaternion RelativeInformation::CalcRelativeAttitudeQuaternion(const int target_sat_id, const int reference_sat_id) {
   // Observer SC Body frame(obs_sat) -> ECI frame(i)
@@ -9,17 +9,22 @@
 #include <windows.h>
 #endif
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <string>
 
 // Simulator includes
+#include "Interface/InitInput/IniAccess.h"
 #include "Interface/LogOutput/Logger.h"
+#include "Simulation/MCSim/InitMcSim.hpp"
+#include "Simulation/MCSim/MCSimProcessFarm.h"
+#include "Simulation/MCSim/MCSimResultSink.h"
+#include "Simulation/MCSim/ParallelMCSimExecutor.h"
 
 // Add custom include files
 #include "Simulation/Case/SampleCase.h"
-// #include "Simulation/MCSim/MCSimExecutor.h"
 // #include "Interface/HilsInOut/COSMOSWrapper.h"
 // #include "Interface/HilsInOut/HardwareMessage.h"
 
@@ -68,9 +73,33 @@ int main(int argc, char *argv[])
   std::cout << "\tIni file: ";
   print_path(ini_file);
 
-  auto simcase = SampleCase(ini_file);
-  simcase.Initialize();
-  simcase.Main();
+  MCSimExecutor* mc_sim = InitMCSim(ini_file);
+  if (mc_sim->IsEnabled()) {
+    // Monte-Carlo simulation: the cases are executed in parallel and the summary of each case is written in a file
+    IniAccess ini = IniAccess(ini_file);
+    const std::string log_path = ini.ReadString("SIM_SETTING", "log_file_path");
+    // The seed 0 means non-deterministic. The seed is read as a 64bit value to reproduce the printed campaign seed.
+    const uint64_t rand_seed = std::strtoull(ini.ReadString("RAND", "Rand_Seed").c_str(), nullptr, 0);
+    mc_sim->SetSeed(rand_seed, rand_seed != 0);
+    std::cout << "\tCampaign seed: 0x" << std::hex << mc_sim->GetSeed() << std::dec << " (set Rand_Seed to reproduce the campaign)" << std::endl;
+
+    auto case_factory = [&](const MCSimExecutor& case_mc_sim) -> SimulationCase* { return new SampleCase(ini_file, case_mc_sim, log_path); };
+    unsigned long long num_of_failed = 0;
+    if (mc_sim->GetExecutionMode() == MCSimExecutionMode::Process) {
+      MCSimProcessFarm farm(*mc_sim, log_path + "mc_results.csv");
+      num_of_failed = farm.Execute(case_factory);
+    } else {
+      MCSimResultSink result_sink(log_path + "mc_results.csv", mc_sim->GetSeed());
+      ParallelMCSimExecutor executor(*mc_sim, result_sink);
+      num_of_failed = executor.Execute(case_factory);
+    }
+    if (num_of_failed > 0) std::cout << num_of_failed << " cases failed" << std::endl;
+  } else {
+    auto simcase = SampleCase(ini_file);
+    simcase.Initialize();
+    simcase.Main();
+  }
+  delete mc_sim;
 
   end = system_clock::now();
   double time = static_cast<double>(duration_cast<microseconds>(end - start).count() / 1000000.0);
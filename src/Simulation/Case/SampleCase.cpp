@@ -11,6 +11,7 @@ using std::cout;
 using std::string;
 
 SampleCase::SampleCase(string ini_base) : SimulationCase(ini_base) {}
+SampleCase::SampleCase(string ini_base, const MCSimExecutor& mc_sim, string log_path) : SimulationCase(ini_base, mc_sim, log_path) {}
 
 SampleCase::~SampleCase() { delete sample_sat_; }
 
@@ -42,9 +43,15 @@ void SampleCase::Main() {
     if (glo_env_->GetSimTime().GetState().log_output) {
       sim_config_.main_logger_->WriteValues();
     }
+    sim_config_.main_logger_->WriteChannelValues(glo_env_->GetSimTime().GetElapsedTicks(), SimTime::GetTicksPerSec());
 
     // Global Environment Update
     glo_env_->Update();
+    // Atmospheric densities of all spacecraft at once. The index of the positions is the spacecraft ID.
+    const SimTime& sim_time = glo_env_->GetSimTime();
+    if (glo_env_->GetAtmosphereService().IsCalcEnabled && sim_time.GetOrbitPropagateFlag()) {
+      glo_env_->GetAtmosphereService().UpdateDensities({sample_sat_->GetDynamics().GetOrbit().GetLatLonAlt()}, sim_time.GetCurrentDecyear());
+    }
     // Spacecraft Update
     sample_sat_->Update(&(glo_env_->GetSimTime()));
     // Ground Station Update
@@ -57,32 +64,19 @@ void SampleCase::Main() {
   }
 }
 
-string SampleCase::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteScalar("time", "s");
-  // str_tmp += WriteVector("position", "i", "m", 3);
-  // str_tmp += WriteVector("velocity", "i", "m/s", 3);
-  // str_tmp += WriteVector("quaternion", "i2b", "-", 4);
-  // str_tmp += WriteVector("omega", "b", "-", 3);
-
-  return str_tmp;
+void SampleCase::GetLogSchema(LogSchema& schema) const {
+  schema.AddScalar("time", "s");
+  // schema.AddVector("position", "i", "m", 3, 16);
+  // schema.AddVector("velocity", "i", "m/s", 3, 10);
+  // schema.AddVector("quaternion", "i2b", "-", 4);
+  // schema.AddVector("omega", "b", "-", 3, 10);
 }
 
-string SampleCase::GetLogValue() const {
-  string str_tmp = "";
-
-  // auto pos_i = sample_sat->dynamics_->GetOrbit().GetSatPosition_i();
-  // auto vel_i = sample_sat->dynamics_->GetOrbit().GetSatVelocity_i();
-  // auto quat_i2b = sample_sat->dynamics_->GetAttitude().GetQuaternion_i2b();
-  // auto omega_b = sample_sat->dynamics_->GetAttitude().GetOmega_b();
-
-  // Need to match the contents of log with header setting above
-  str_tmp += WriteScalar(glo_env_->GetSimTime().GetElapsedSec());
-  // str_tmp += WriteVector(pos_i, 16);
-  // str_tmp += WriteVector(vel_i, 10);
-  // str_tmp += WriteQuaternion(quat_i2b);
-  // str_tmp += WriteVector(omega_b, 10);
-
-  return str_tmp;
+void SampleCase::LogValues(LogSink& sink) const {
+  // Need to match the contents of log with schema setting above
+  sink.Add(glo_env_->GetSimTime().GetElapsedSec());
+  // sink.Add(sample_sat_->dynamics_->GetOrbit().GetSatPosition_i());
+  // sink.Add(sample_sat_->dynamics_->GetOrbit().GetSatVelocity_i());
+  // sink.Add(sample_sat_->dynamics_->GetAttitude().GetQuaternion_i2b());
+  // sink.Add(sample_sat_->dynamics_->GetAttitude().GetOmega_b());
 }
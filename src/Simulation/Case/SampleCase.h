@@ -20,6 +20,11 @@ class SampleCase : public SimulationCase {
    * @brief Constructor
    */
   SampleCase(std::string ini_base);
+  /**
+   * @fn SampleCase
+   * @brief Constructor for Monte-Carlo Simulation
+   */
+  SampleCase(std::string ini_base, const MCSimExecutor& mc_sim, std::string log_path);
 
   /**
    * @fn ~SampleCase
@@ -40,15 +45,15 @@ class SampleCase : public SimulationCase {
   void Main();
 
   /**
-   * @fn GetLogHeader
-   * @brief Override function of GetLogHeader
+   * @fn GetLogSchema
+   * @brief Override function of GetLogSchema
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override function of GetLogValue
+   * @fn LogValues
+   * @brief Override function of LogValues
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
  private:
   SampleSat* sample_sat_;     //!< Instance of spacecraft
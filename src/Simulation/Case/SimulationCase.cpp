@@ -8,6 +8,7 @@
 #include <Interface/InitInput/IniAccess.h>
 
 #include <Interface/LogOutput/InitLog.hpp>
+#include <Library/math/NormalRand.hpp>
 #include <string>
 
 SimulationCase::SimulationCase(std::string ini_base) {
@@ -20,6 +21,8 @@ SimulationCase::SimulationCase(std::string ini_base) {
   sim_config_.gs_file_ = simbase_ini.ReadString(section, "gs_file");
   sim_config_.inter_sat_comm_file_ = simbase_ini.ReadString(section, "inter_sat_comm_file");
   sim_config_.gnss_file_ = simbase_ini.ReadString(section, "gnss_file");
+  // Random noise generation of the components
+  libra::NormalRand::set_default_buffered(simbase_ini.ReadEnable("RAND", "Buffered_Normal_Rand"));
   glo_env_ = new GlobalEnvironment(&sim_config_);
 }
 SimulationCase::SimulationCase(std::string ini_base, const MCSimExecutor& mc_sim, const std::string log_path) {
@@ -29,12 +32,15 @@ SimulationCase::SimulationCase(std::string ini_base, const MCSimExecutor& mc_sim
   // Log for Monte Carlo Simulation
   std::string log_file_name = "default" + std::to_string(mc_sim.GetNumOfExecutionsDone()) + ".csv";
   // ToDo: Consider that `enable_inilog = false` is fine or not?
-  sim_config_.main_logger_ = new Logger(log_file_name, log_path, ini_base, false, mc_sim.LogHistory());
+  sim_config_.main_logger_ = new Logger(log_file_name, log_path, ini_base, false, mc_sim.LogHistory(), InitLogFormat(ini_base));
+  InitLogSettings(*sim_config_.main_logger_, ini_base);
   sim_config_.num_of_simulated_spacecraft_ = simbase_ini.ReadInt(section, "num_of_simulated_spacecraft");
   sim_config_.sat_file_ = simbase_ini.ReadStrVector(section, "sat_file");
   sim_config_.gs_file_ = simbase_ini.ReadString(section, "gs_file");
   sim_config_.inter_sat_comm_file_ = simbase_ini.ReadString(section, "inter_sat_comm_file");
   sim_config_.gnss_file_ = simbase_ini.ReadString(section, "gnss_file");
+  // Random noise generation of the components
+  libra::NormalRand::set_default_buffered(simbase_ini.ReadEnable("RAND", "Buffered_Normal_Rand"));
   // Global Environment
   glo_env_ = new GlobalEnvironment(&sim_config_);
 }
@@ -47,15 +47,15 @@ class SimulationCase : public ILoggable {
   virtual void Main() = 0;
 
   /**
-   * @fn GetLogHeader
-   * @brief Virtual function of Log header settings for Monte-Carlo Simulation result
+   * @fn GetLogSchema
+   * @brief Virtual function of Log schema settings for Monte-Carlo Simulation result
    */
-  virtual std::string GetLogHeader() const = 0;
+  virtual void GetLogSchema(LogSchema& schema) const = 0;
   /**
-   * @fn GetLogValue
-   * @brief Virtual function of Log value settings for Monte-Carlo Simulation result
+   * @fn LogValues
+   * @brief Virtual function of Log value output for Monte-Carlo Simulation result
    */
-  virtual std::string GetLogValue() const = 0;
+  virtual void LogValues(LogSink& sink) const = 0;
 
   // Getter
   /**
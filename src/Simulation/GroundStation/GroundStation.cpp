@@ -44,7 +44,7 @@ void GroundStation::Initialize(int gs_id, SimulationConfig* config) {
   config->main_logger_->CopyFileToLogDir(gs_ini_path);
 }
 
-void GroundStation::LogSetup(Logger& logger) { logger.AddLoggable(this); }
+void GroundStation::LogSetup(Logger& logger) { logger.AddLoggable(this, "ground_station"); }
 
 void GroundStation::Update(const CelestialRotation& celes_rotation, const Spacecraft& spacecraft) {
   Matrix<3, 3> dcm_ecef2eci = transpose(celes_rotation.GetDCMJ2000toXCXF());
@@ -83,21 +83,15 @@ bool GroundStation::CalcIsVisible(const Vector<3> sc_pos_ecef_m) {
   }
 }
 
-std::string GroundStation::GetLogHeader() const {
-  std::string str_tmp = "";
-
+void GroundStation::GetLogSchema(LogSchema& schema) const {
   for (int i = 0; i < num_sc_; i++) {
     std::string legend = "is_sc" + std::to_string(i) + "_visible_from_gs" + std::to_string(gs_id_);
-    str_tmp += WriteScalar(legend);
+    schema.AddColumn(legend, 6, LogValueType::Int64);
   }
-  return str_tmp;
 }
 
-std::string GroundStation::GetLogValue() const {
-  std::string str_tmp = "";
-
+void GroundStation::LogValues(LogSink& sink) const {
   for (int i = 0; i < num_sc_; i++) {
-    str_tmp += WriteScalar(is_visible_.at(i));
+    sink.Add(is_visible_.at(i));
   }
-  return str_tmp;
 }
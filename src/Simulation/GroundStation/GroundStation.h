@@ -48,15 +48,15 @@ class GroundStation : public ILoggable {
 
   // Override functions for ILoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override function of log header setting
+   * @fn GetLogSchema
+   * @brief Override function of log schema setting
    */
-  virtual std::string GetLogHeader() const;
+  virtual void GetLogSchema(LogSchema& schema) const;
   /**
-   * @fn GetLogValue
-   * @brief Override function of log value setting
+   * @fn LogValues
+   * @brief Override function of log value output
    */
-  virtual std::string GetLogValue() const;
+  virtual void LogValues(LogSink& sink) const;
 
   // Getters
   /**
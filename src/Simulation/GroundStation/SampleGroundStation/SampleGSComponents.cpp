@@ -24,5 +24,5 @@ SampleGSComponents::~SampleGSComponents() {
 
 void SampleGSComponents::CompoLogSetUp(Logger& logger) {
   // logger.AddLoggable(ant_);
-  logger.AddLoggable(gs_calculator_);
+  logger.AddLoggable(gs_calculator_, "ground_station");
 }
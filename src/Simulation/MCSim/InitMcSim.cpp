@@ -21,13 +21,22 @@ MCSimExecutor* InitMCSim(std::string file_name) {
 
   char endis_str[MAX_CHAR_NUM];
   ini_file.ReadChar(section, "MCSimEnabled", MAX_CHAR_NUM, endis_str);
-  bool enable = (strcmp(endis_str, "ENABLED") == 0);
+  bool enable = (strcmp(endis_str, "ENABLED") == 0) || (strcmp(endis_str, "ENABLE") == 0);
   mc_sim->Enable(enable);
 
   ini_file.ReadChar(section, "LogHistory", MAX_CHAR_NUM, endis_str);
-  bool log_history = (strcmp(endis_str, "ENABLED") == 0);
+  bool log_history = (strcmp(endis_str, "ENABLED") == 0) || (strcmp(endis_str, "ENABLE") == 0);
   mc_sim->LogHistory(log_history);
 
+  mc_sim->SetNumOfThreads(ini_file.ReadInt(section, "NumOfThreads"));
+
+  ini_file.ReadChar(section, "ExecutionMode", MAX_CHAR_NUM, endis_str);
+  if (strcmp(endis_str, "PROCESS") == 0) {
+    mc_sim->SetExecutionMode(MCSimExecutionMode::Process);
+  } else {
+    mc_sim->SetExecutionMode(MCSimExecutionMode::Thread);
+  }
+
   section = "MC_RANDOMIZATION";
   std::vector<std::string> so_dot_ip_str_vec = ini_file.ReadStrVector(section, "Param");
   std::vector<std::string> so_str_vec, ip_str_vec;
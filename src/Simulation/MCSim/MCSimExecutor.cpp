@@ -5,12 +5,36 @@
 
 #include "MCSimExecutor.h"
 
+#include <random>
+
 using std::string;
 
 MCSimExecutor::MCSimExecutor(unsigned long long total_num_of_executions) : total_num_of_executions_(total_num_of_executions) {
   num_of_executions_done_ = 0;
   enabled_ = total_num_of_executions_ > 1 ? true : false;
   log_history_ = !enabled_;
+  num_of_threads_ = 0;
+  execution_mode_ = MCSimExecutionMode::Thread;
+  SetSeed();
+}
+
+MCSimExecutor::MCSimExecutor(const MCSimExecutor& obj)
+    : total_num_of_executions_(obj.total_num_of_executions_),
+      num_of_executions_done_(obj.num_of_executions_done_),
+      enabled_(obj.enabled_),
+      log_history_(obj.log_history_),
+      num_of_threads_(obj.num_of_threads_),
+      execution_mode_(obj.execution_mode_),
+      campaign_seed_(obj.campaign_seed_) {
+  for (auto ip : obj.ip_list_) {
+    ip_list_[ip.first] = new InitParameter(*ip.second);
+  }
+}
+
+MCSimExecutor::~MCSimExecutor() {
+  for (auto ip : ip_list_) {
+    delete ip.second;
+  }
 }
 
 bool MCSimExecutor::WillExecuteNextCase() {
@@ -59,8 +83,16 @@ void MCSimExecutor::GetInitParameterQuaternion(string so_name, string ip_name, Q
 
 void MCSimExecutor::RandomizeAllParameters() {
   for (auto ip : ip_list_) {
-    ip.second->Randomize();
+    // Each parameter has its own stream for each case
+    ip.second->Randomize(libra::PhiloxRand(campaign_seed_, num_of_executions_done_, ip.first, 0));
   }
 }
 
-void MCSimExecutor::SetSeed(unsigned long seed, bool is_deterministic) { InitParameter::SetSeed(seed, is_deterministic); }
+void MCSimExecutor::SetSeed(uint64_t seed, bool is_deterministic) {
+  if (is_deterministic) {
+    campaign_seed_ = seed;
+  } else {
+    std::random_device rnd;
+    campaign_seed_ = ((uint64_t)rnd() << 32) | rnd();
+  }
+}
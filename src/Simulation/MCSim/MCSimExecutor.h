@@ -6,6 +6,7 @@
 #pragma once
 
 #include <Library/math/Vector.hpp>
+#include <cstdint>
 #include <map>
 #include <string>
 //#include "SimulationObject.h"
@@ -13,6 +14,15 @@
 
 using libra::Vector;
 
+/**
+ * @enum MCSimExecutionMode
+ * @brief Parallelization of the Monte-Carlo simulation cases
+ */
+enum class MCSimExecutionMode {
+  Thread,   //!< Execute the cases on worker threads in the process
+  Process,  //!< Initialize the shared data once and execute the cases on forked worker processes
+};
+
 /**
  * @class MCSimExecutor
  * @brief Monte-Carlo Simulation Executor class
@@ -23,6 +33,9 @@ class MCSimExecutor {
   unsigned long long num_of_executions_done_;   //!< Number of executed case
   bool enabled_;                                //!< Flag to execute Monte-Carlo Simulation or not
   bool log_history_;                            //!< Flag to store the log for each case or not
+  unsigned int num_of_threads_;                 //!< Number of worker threads or processes for the parallel execution (0: number of hardware threads)
+  MCSimExecutionMode execution_mode_;           //!< Parallelization of the cases
+  uint64_t campaign_seed_;                      //!< Seed of the campaign
 
   std::map<std::string, InitParameter*> ip_list_;  //!< List of InitParameters read from MCSim.ini
 
@@ -34,6 +47,22 @@ class MCSimExecutor {
    * @brief Constructor
    */
   MCSimExecutor(unsigned long long total_num_of_executions);
+  /**
+   * @fn MCSimExecutor
+   * @brief Copy constructor
+   * @note The InitParameters are deeply copied. The copy is used as a snapshot of the randomized parameters for a case.
+   */
+  MCSimExecutor(const MCSimExecutor& obj);
+  /**
+   * @fn operator=
+   * @brief Copy assignment is not allowed since the executor owns the InitParameters. Use the copy constructor to make a snapshot.
+   */
+  MCSimExecutor& operator=(const MCSimExecutor& obj) = delete;
+  /**
+   * @fn ~MCSimExecutor
+   * @brief Destructor
+   */
+  ~MCSimExecutor();
 
   // Setter
   /**
@@ -51,11 +80,23 @@ class MCSimExecutor {
    * @brief Set log history flag
    */
   inline void LogHistory(bool set);
+  /**
+   * @fn SetNumOfThreads
+   * @brief Set number of worker threads for the parallel execution
+   */
+  inline void SetNumOfThreads(unsigned int num_of_threads);
+  /**
+   * @fn SetExecutionMode
+   * @brief Set parallelization of the cases
+   */
+  inline void SetExecutionMode(MCSimExecutionMode execution_mode);
   /**
    * @fn SetSeed
-   * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
+   * @brief Set seed of the campaign. Use non-deterministic random device when is_deterministic = false.
+   * @note The parameters of a case are randomized with the counter-based stream keyed by the campaign seed, the case ID, and the name of
+   *       the parameter. The results do not depend on the order of the randomization and a case can be re-executed alone.
    */
-  static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  void SetSeed(uint64_t seed = 0, bool is_deterministic = false);
 
   // Getter
   /**
@@ -78,6 +119,21 @@ class MCSimExecutor {
    * @brief Return log history flag
    */
   inline bool LogHistory() const;
+  /**
+   * @fn GetNumOfThreads
+   * @brief Return number of worker threads for the parallel execution (0: number of hardware threads)
+   */
+  inline unsigned int GetNumOfThreads() const;
+  /**
+   * @fn GetExecutionMode
+   * @brief Return parallelization of the cases
+   */
+  inline MCSimExecutionMode GetExecutionMode() const;
+  /**
+   * @fn GetSeed
+   * @brief Return seed of the campaign
+   */
+  inline uint64_t GetSeed() const;
   /**
    * @fn GetInitParameterVec
    * @brief Get randomized vector value and store it in dest_vec
@@ -148,6 +204,16 @@ bool MCSimExecutor::LogHistory() const {
 
 void MCSimExecutor::LogHistory(bool set) { log_history_ = set; }
 
+void MCSimExecutor::SetNumOfThreads(unsigned int num_of_threads) { num_of_threads_ = num_of_threads; }
+
+unsigned int MCSimExecutor::GetNumOfThreads() const { return num_of_threads_; }
+
+void MCSimExecutor::SetExecutionMode(MCSimExecutionMode execution_mode) { execution_mode_ = execution_mode; }
+
+MCSimExecutionMode MCSimExecutor::GetExecutionMode() const { return execution_mode_; }
+
+uint64_t MCSimExecutor::GetSeed() const { return campaign_seed_; }
+
 template <size_t NumElement>
 void MCSimExecutor::GetInitParameterVec(std::string so_name, std::string ip_name, Vector<NumElement>& dst_vec) const {
   if (!enabled_) return;
@@ -0,0 +1,186 @@
+/**
+ * @file MCSimProcessFarm.cpp
+ * @brief Executor of Monte-Carlo simulation cases on forked worker processes
+ */
+
+#include "MCSimProcessFarm.h"
+
+#include <Simulation/Case/SimulationCase.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef WIN32
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+using namespace std;
+
+MCSimProcessFarm::MCSimProcessFarm(MCSimExecutor& mc_sim, const string& result_file_path) : mc_sim_(mc_sim), result_file_path_(result_file_path) {
+  num_of_processes_ = mc_sim_.GetNumOfThreads();
+  if (num_of_processes_ == 0) num_of_processes_ = thread::hardware_concurrency();
+  if (num_of_processes_ == 0) num_of_processes_ = 1;
+}
+
+#ifdef WIN32
+unsigned long long MCSimProcessFarm::Execute(const ParallelMCSimExecutor::CaseFactory& case_factory) {
+  // fork is not available. Execute the cases on threads instead.
+  cout << "Process mode is not supported on this system. Monte-Carlo simulation is executed on threads." << endl;
+  MCSimResultSink result_sink(result_file_path_, mc_sim_.GetSeed());
+  ParallelMCSimExecutor executor(mc_sim_, result_sink);
+  return executor.Execute(case_factory);
+}
+#else
+unsigned long long MCSimProcessFarm::Execute(const ParallelMCSimExecutor::CaseFactory& case_factory) {
+  WarmUp(case_factory);
+
+  // Randomize all cases before the fork
+  vector<unique_ptr<MCSimExecutor>> cases;
+  while (auto case_mc_sim = ParallelMCSimExecutor::TakeNextCase(mc_sim_)) cases.push_back(move(case_mc_sim));
+  const uint64_t num_of_cases = cases.size();
+  if (num_of_processes_ > num_of_cases) num_of_processes_ = (unsigned int)max<uint64_t>(num_of_cases, 1);
+
+  // Work queue of the case indices
+  int queue_fd[2];
+  if (pipe(queue_fd) != 0) {
+    cerr << "Error making the work queue of the process farm" << endl;
+    return num_of_cases;
+  }
+
+  cout << "Monte-Carlo simulation with " << num_of_processes_ << " processes" << endl;
+  cout.flush();
+  fflush(stdout);
+
+  vector<pid_t> workers;
+  for (unsigned int worker_id = 0; worker_id < num_of_processes_; worker_id++) {
+    const pid_t pid = fork();
+    if (pid < 0) {
+      cerr << "Error forking the worker process " << worker_id << endl;
+      break;
+    }
+    if (pid == 0) {
+      // Worker process
+      close(queue_fd[1]);
+      {
+        MCSimResultSink result_sink(GetWorkerResultFilePath(worker_id), mc_sim_.GetSeed());
+        uint64_t case_idx;
+        while (true) {
+          const ssize_t size = read(queue_fd[0], &case_idx, sizeof(case_idx));
+          if (size < 0 && errno == EINTR) continue;
+          if (size != sizeof(case_idx)) break;
+          ParallelMCSimExecutor::RunCase(*cases[case_idx], case_factory, result_sink);
+        }
+      }
+      close(queue_fd[0]);
+      cout.flush();
+      _exit(EXIT_SUCCESS);
+    }
+    workers.push_back(pid);
+  }
+  close(queue_fd[0]);
+
+  if (workers.empty()) {
+    // Execute in the launcher when no worker is available
+    close(queue_fd[1]);
+    MCSimResultSink result_sink(GetWorkerResultFilePath(0), mc_sim_.GetSeed());
+    for (auto& case_mc_sim : cases) ParallelMCSimExecutor::RunCase(*case_mc_sim, case_factory, result_sink);
+  } else {
+    // The writes of the indices are atomic since they are smaller than PIPE_BUF
+    signal(SIGPIPE, SIG_IGN);
+    for (uint64_t case_idx = 0; case_idx < num_of_cases; case_idx++) {
+      ssize_t size;
+      do {
+        size = write(queue_fd[1], &case_idx, sizeof(case_idx));
+      } while (size < 0 && errno == EINTR);
+      if (size != sizeof(case_idx)) {
+        cerr << "Error writing the work queue. All workers might be terminated." << endl;
+        break;
+      }
+    }
+    close(queue_fd[1]);
+
+    for (pid_t pid : workers) {
+      int status = 0;
+      pid_t result;
+      do {
+        result = waitpid(pid, &status, 0);
+      } while (result < 0 && errno == EINTR);
+      if (result < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+        cerr << "Worker process " << pid << " terminated abnormally" << endl;
+      }
+    }
+  }
+
+  const unsigned long long num_of_succeeded = MergeResults();
+  return num_of_cases - num_of_succeeded;
+}
+#endif
+
+void MCSimProcessFarm::WarmUp(const ParallelMCSimExecutor::CaseFactory& case_factory) {
+  MCSimExecutor warm_up_mc_sim(mc_sim_);
+  warm_up_mc_sim.LogHistory(false);
+  try {
+    unique_ptr<SimulationCase> warm_up_case(case_factory(warm_up_mc_sim));
+    warm_up_case->Initialize();
+  } catch (const exception& e) {
+    cerr << "Error in the warm-up case: " << e.what() << endl;
+  } catch (const char* message) {
+    cerr << "Error in the warm-up case: " << message << endl;
+  }
+}
+
+string MCSimProcessFarm::GetWorkerResultFilePath(const unsigned int worker_id) const {
+  return result_file_path_ + ".worker" + to_string(worker_id);
+}
+
+unsigned long long MCSimProcessFarm::MergeResults() const {
+  const string header_prefix = "case_id,";
+  string header;
+  vector<pair<unsigned long long, string>> lines;
+  unsigned long long num_of_succeeded = 0;
+
+  for (unsigned int worker_id = 0; worker_id < num_of_processes_; worker_id++) {
+    const string worker_file_path = GetWorkerResultFilePath(worker_id);
+    ifstream ifs(worker_file_path);
+    if (!ifs.is_open()) continue;
+    string line;
+    while (getline(ifs, line)) {
+      if (line.compare(0, header_prefix.size(), header_prefix) == 0) {
+        header = line;
+        continue;
+      }
+      if (line.empty()) continue;
+      lines.emplace_back(stoull(line), line);
+      // case_id,campaign_seed,execution_time,status,...
+      const size_t status_pos = line.find(',', line.find(',', line.find(',') + 1) + 1) + 1;
+      if (line.compare(status_pos, 3, "OK,") == 0) num_of_succeeded++;
+    }
+    ifs.close();
+    remove(worker_file_path.c_str());
+  }
+  stable_sort(lines.begin(), lines.end(), [](const pair<unsigned long long, string>& a, const pair<unsigned long long, string>& b) {
+    return a.first < b.first;
+  });
+
+  ofstream ofs(result_file_path_);
+  if (!ofs.is_open()) {
+    cerr << "Error opening Monte-Carlo result file: " << result_file_path_ << endl;
+    return num_of_succeeded;
+  }
+  if (!header.empty()) ofs << header << "\n";
+  for (const auto& line : lines) ofs << line.second << "\n";
+  return num_of_succeeded;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file MCSimProcessFarm.h
+ * @brief Executor of Monte-Carlo simulation cases on forked worker processes
+ */
+
+#pragma once
+
+#include <string>
+
+#include "ParallelMCSimExecutor.h"
+
+/**
+ * @class MCSimProcessFarm
+ * @brief Executor of Monte-Carlo simulation cases on forked worker processes
+ * @note A warm-up case is initialized in the launcher process to load the heavy read-only data (SPICE kernels, Chebyshev ephemerides,
+ *       geo-potential coefficients, IGRF coefficients, Hipparcos catalogue, and GNSS files) into the process-wide caches. The worker
+ *       processes are forked after that and share those pages with copy-on-write, so that the case initialization does not read
+ *       files. The libraries do not need to be thread-safe since each worker process executes one case at a time.
+ *       The parameters of all cases are randomized in the launcher before the fork, and the workers take the case indices from a pipe.
+ *       Each worker writes the summary to its own file, and the launcher merges them in the case order after all workers finish.
+ *       This mode is available on POSIX systems only. ParallelMCSimExecutor is used on the other systems.
+ */
+class MCSimProcessFarm {
+ public:
+  /**
+   * @fn MCSimProcessFarm
+   * @brief Constructor
+   * @param [in] mc_sim: Monte-Carlo simulation setting. The number of executed case is updated.
+   * @param [in] result_file_path: Path to the output CSV file of the summary of each case
+   */
+  MCSimProcessFarm(MCSimExecutor& mc_sim, const std::string& result_file_path);
+
+  /**
+   * @fn Execute
+   * @brief Execute all cases and return after all workers finish
+   * @param [in] case_factory: Function to make a simulation case
+   * @return Number of failed cases including the cases lost with abnormally terminated workers
+   */
+  unsigned long long Execute(const ParallelMCSimExecutor::CaseFactory& case_factory);
+
+  /**
+   * @fn GetNumOfProcesses
+   * @brief Return number of worker processes used in the execution
+   */
+  inline unsigned int GetNumOfProcesses() const { return num_of_processes_; }
+
+ private:
+  MCSimExecutor& mc_sim_;          //!< Monte-Carlo simulation setting
+  std::string result_file_path_;   //!< Path to the output CSV file of the summary of each case
+  unsigned int num_of_processes_;  //!< Number of worker processes
+
+  /**
+   * @fn WarmUp
+   * @brief Initialize a case without log output to fill the process-wide caches of the read-only data
+   * @param [in] case_factory: Function to make a simulation case
+   */
+  void WarmUp(const ParallelMCSimExecutor::CaseFactory& case_factory);
+  /**
+   * @fn GetWorkerResultFilePath
+   * @brief Return path to the result file of a worker
+   * @param [in] worker_id: ID of the worker
+   */
+  std::string GetWorkerResultFilePath(const unsigned int worker_id) const;
+  /**
+   * @fn MergeResults
+   * @brief Merge the result files of the workers in the case order and remove them
+   * @return Number of cases in the merged file
+   */
+  unsigned long long MergeResults() const;
+};
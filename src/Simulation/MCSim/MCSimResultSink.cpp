@@ -0,0 +1,45 @@
+/**
+ * @file MCSimResultSink.cpp
+ * @brief Shared output of the summary of each Monte-Carlo simulation case
+ */
+
+#include "MCSimResultSink.h"
+
+#include <Simulation/Case/SimulationCase.h>
+
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+MCSimResultSink::MCSimResultSink(const string& file_path, const uint64_t campaign_seed) : is_header_written_(false) {
+  stringstream seed;
+  seed << "0x" << hex << campaign_seed;
+  seed_ = seed.str();
+  csv_file_.open(file_path);
+  if (!csv_file_.is_open()) cerr << "Error opening Monte-Carlo result file: " << file_path << endl;
+}
+
+MCSimResultSink::~MCSimResultSink() {
+  if (csv_file_.is_open()) csv_file_.close();
+}
+
+void MCSimResultSink::Write(const unsigned long long case_id, const SimulationCase& simulation_case, const double execution_time_s) {
+  // Make the strings before locking
+  const string header = simulation_case.GetLogHeader();
+  const string value = simulation_case.GetLogValue();
+
+  lock_guard<mutex> lock(mutex_);
+  if (!is_header_written_) {
+    csv_file_ << "case_id,campaign_seed,execution_time[s],status," << header << "\n";
+    is_header_written_ = true;
+  }
+  csv_file_ << case_id << "," << seed_ << "," << execution_time_s << ",OK," << value << "\n";
+  csv_file_.flush();
+}
+
+void MCSimResultSink::WriteError(const unsigned long long case_id, const string& message) {
+  lock_guard<mutex> lock(mutex_);
+  csv_file_ << case_id << "," << seed_ << ",0,ERROR: " << message << ",\n";
+  csv_file_.flush();
+}
@@ -0,0 +1,57 @@
+/**
+ * @file MCSimResultSink.h
+ * @brief Shared output of the summary of each Monte-Carlo simulation case
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+class SimulationCase;
+
+/**
+ * @class MCSimResultSink
+ * @brief Shared output of the summary of each Monte-Carlo simulation case
+ * @note Cases finished on the worker threads write one line each. The lines are written in the finished order and the case ID is in
+ *       the first column. The seed of the campaign is in the second column to reproduce the campaign and each case.
+ */
+class MCSimResultSink {
+ public:
+  /**
+   * @fn MCSimResultSink
+   * @brief Constructor
+   * @param [in] file_path: Path to the output CSV file
+   * @param [in] campaign_seed: Seed of the campaign
+   */
+  MCSimResultSink(const std::string& file_path, const uint64_t campaign_seed);
+  /**
+   * @fn ~MCSimResultSink
+   * @brief Destructor
+   */
+  ~MCSimResultSink();
+
+  /**
+   * @fn Write
+   * @brief Write the summary of a finished case. The header is written with the first case.
+   * @param [in] case_id: ID of the case
+   * @param [in] simulation_case: The finished case
+   * @param [in] execution_time_s: Execution time of the case [s]
+   */
+  void Write(const unsigned long long case_id, const SimulationCase& simulation_case, const double execution_time_s);
+  /**
+   * @fn WriteError
+   * @brief Write the failure of a case
+   * @param [in] case_id: ID of the case
+   * @param [in] message: Error message
+   */
+  void WriteError(const unsigned long long case_id, const std::string& message);
+
+ private:
+  std::ofstream csv_file_;  //!< CSV file stream
+  std::string seed_;        //!< Seed of the campaign in hexadecimal
+  bool is_header_written_;  //!< Is the header written?
+  std::mutex mutex_;        //!< Mutex for the file stream
+};
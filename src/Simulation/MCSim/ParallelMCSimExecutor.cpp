@@ -0,0 +1,102 @@
+/**
+ * @file ParallelMCSimExecutor.cpp
+ * @brief Executor of Monte-Carlo simulation cases on worker threads
+ */
+
+#include "ParallelMCSimExecutor.h"
+
+#include <Interface/LogOutput/Logger.h>
+#include <Library/math/GlobalRand.h>
+#include <Simulation/Case/SimulationCase.h>
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "SimulationObject.h"
+
+using namespace std;
+
+ParallelMCSimExecutor::ParallelMCSimExecutor(MCSimExecutor& mc_sim, MCSimResultSink& result_sink)
+    : mc_sim_(mc_sim), result_sink_(result_sink), num_of_failed_(0) {
+  num_of_threads_ = mc_sim_.GetNumOfThreads();
+  if (num_of_threads_ == 0) num_of_threads_ = thread::hardware_concurrency();
+  if (num_of_threads_ == 0) num_of_threads_ = 1;
+}
+
+unsigned long long ParallelMCSimExecutor::Execute(const CaseFactory& case_factory) {
+  num_of_failed_ = 0;
+  cout << "Monte-Carlo simulation with " << num_of_threads_ << " threads" << endl;
+
+  vector<thread> workers;
+  for (unsigned int i = 1; i < num_of_threads_; i++) {
+    workers.emplace_back(&ParallelMCSimExecutor::WorkerLoop, this, cref(case_factory));
+  }
+  // The main thread also works
+  WorkerLoop(case_factory);
+  for (auto& worker : workers) worker.join();
+
+  return num_of_failed_;
+}
+
+void ParallelMCSimExecutor::WorkerLoop(const CaseFactory& case_factory) {
+  while (true) {
+    unique_ptr<MCSimExecutor> case_mc_sim;
+    {
+      lock_guard<mutex> lock(dispatch_mutex_);
+      case_mc_sim = TakeNextCase(mc_sim_);
+    }
+    if (!case_mc_sim) break;
+
+    if (!RunCase(*case_mc_sim, case_factory, result_sink_)) {
+      lock_guard<mutex> lock(dispatch_mutex_);
+      num_of_failed_++;
+    }
+  }
+}
+
+unique_ptr<MCSimExecutor> ParallelMCSimExecutor::TakeNextCase(MCSimExecutor& mc_sim) {
+  if (!mc_sim.WillExecuteNextCase()) return nullptr;
+  mc_sim.AtTheBeginningOfEachCase();
+  mc_sim.RandomizeAllParameters();
+  unique_ptr<MCSimExecutor> case_mc_sim(new MCSimExecutor(mc_sim));
+  mc_sim.AtTheEndOfEachCase();
+  return case_mc_sim;
+}
+
+bool ParallelMCSimExecutor::RunCase(const MCSimExecutor& case_mc_sim, const CaseFactory& case_factory, MCSimResultSink& result_sink) {
+  using namespace std::chrono;
+
+  const unsigned long long case_id = case_mc_sim.GetNumOfExecutionsDone();
+  const steady_clock::time_point start = steady_clock::now();
+  g_rand.SetCaseSeed(case_mc_sim.GetSeed(), case_id);
+
+  // The case is kept after an exception to write its flight recorder
+  unique_ptr<SimulationCase> simulation_case;
+  try {
+    simulation_case.reset(case_factory(case_mc_sim));
+    simulation_case->Initialize();
+    SimulationObject::SetAllParameters(case_mc_sim);
+    simulation_case->Main();
+
+    const double execution_time_s = duration_cast<microseconds>(steady_clock::now() - start).count() / 1000000.0;
+    result_sink.Write(case_id, *simulation_case, execution_time_s);
+  } catch (const exception& e) {
+    TriggerFlightRecorder(simulation_case.get(), e.what());
+    result_sink.WriteError(case_id, e.what());
+    return false;
+  } catch (const char* message) {
+    TriggerFlightRecorder(simulation_case.get(), message);
+    result_sink.WriteError(case_id, message);
+    return false;
+  }
+  return true;
+}
+
+void ParallelMCSimExecutor::TriggerFlightRecorder(SimulationCase* simulation_case, const string& message) {
+  if (simulation_case == nullptr || simulation_case->GetSimConfig().main_logger_ == nullptr) return;
+  simulation_case->GetSimConfig().main_logger_->TriggerFlightRecorder("exception: " + message);
+}
@@ -0,0 +1,93 @@
+/**
+ * @file ParallelMCSimExecutor.h
+ * @brief Executor of Monte-Carlo simulation cases on worker threads
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "MCSimExecutor.h"
+#include "MCSimResultSink.h"
+
+class SimulationCase;
+
+/**
+ * @class ParallelMCSimExecutor
+ * @brief Executor of Monte-Carlo simulation cases on worker threads
+ * @note Each worker takes the next case index when it finishes its case, so that cases with different execution times are balanced.
+ *       The parameters of a case are randomized with the streams keyed by the case index and copied to the case, and the global
+ *       randomization (g_rand) of each thread is keyed by the campaign seed and the case index before the case is made. Thus the results
+ *       of a case do not depend on the number of threads and the scheduling.
+ */
+class ParallelMCSimExecutor {
+ public:
+  /**
+   * @typedef CaseFactory
+   * @brief Function to make a simulation case from the randomized parameters of the case
+   */
+  using CaseFactory = std::function<SimulationCase*(const MCSimExecutor& mc_sim)>;
+
+  /**
+   * @fn ParallelMCSimExecutor
+   * @brief Constructor
+   * @param [in] mc_sim: Monte-Carlo simulation setting. The number of executed case is updated.
+   * @param [in] result_sink: Output of the summary of each case
+   */
+  ParallelMCSimExecutor(MCSimExecutor& mc_sim, MCSimResultSink& result_sink);
+
+  /**
+   * @fn Execute
+   * @brief Execute all cases and return after all workers finish
+   * @param [in] case_factory: Function to make a simulation case
+   * @return Number of failed cases
+   */
+  unsigned long long Execute(const CaseFactory& case_factory);
+
+  /**
+   * @fn GetNumOfThreads
+   * @brief Return number of worker threads used in the execution
+   */
+  inline unsigned int GetNumOfThreads() const { return num_of_threads_; }
+
+  /**
+   * @fn TakeNextCase
+   * @brief Randomize the parameters of the next case and return the copy of them
+   * @note The caller must serialize the calls since the number of executed case is updated
+   * @param [in] mc_sim: Monte-Carlo simulation setting. The number of executed case is updated.
+   * @return Randomized parameters of the next case. nullptr when all cases are taken.
+   */
+  static std::unique_ptr<MCSimExecutor> TakeNextCase(MCSimExecutor& mc_sim);
+  /**
+   * @fn RunCase
+   * @brief Execute a case on the current thread
+   * @param [in] case_mc_sim: Randomized parameters of the case
+   * @param [in] case_factory: Function to make a simulation case
+   * @param [in] result_sink: Output of the summary of the case
+   * @return False when the case failed
+   */
+  static bool RunCase(const MCSimExecutor& case_mc_sim, const CaseFactory& case_factory, MCSimResultSink& result_sink);
+
+ private:
+  MCSimExecutor& mc_sim_;             //!< Monte-Carlo simulation setting
+  MCSimResultSink& result_sink_;      //!< Output of the summary of each case
+  unsigned int num_of_threads_;       //!< Number of worker threads
+  std::mutex dispatch_mutex_;         //!< Mutex for the case dispatch and the randomization
+  unsigned long long num_of_failed_;  //!< Number of failed cases
+
+  /**
+   * @fn WorkerLoop
+   * @brief Main routine of a worker thread
+   * @param [in] case_factory: Function to make a simulation case
+   */
+  void WorkerLoop(const CaseFactory& case_factory);
+  /**
+   * @fn TriggerFlightRecorder
+   * @brief Write the flight recorder of the case stopped by an exception
+   * @param [in] simulation_case: Simulation case (nullptr when the case is not made)
+   * @param [in] message: Message of the exception
+   */
+  static void TriggerFlightRecorder(SimulationCase* simulation_case, const std::string& message);
+};
@@ -5,7 +5,7 @@
 
 #include "SimulationObject.h"
 
-std::map<std::string, SimulationObject*> SimulationObject::so_list_;
+thread_local std::map<std::string, SimulationObject*> SimulationObject::so_list_;
 
 SimulationObject::SimulationObject(std::string name) : name_(name) {
   // Check the name is already registered in so_list
@@ -68,7 +68,8 @@ class SimulationObject {
 
  private:
   std::string name_;  //!< Name to distinguish the target variable in initialize file for Monte-Carlo simulation
-  static std::map<std::string, SimulationObject*> so_list_;  //!< list of objects with simulation parameters
+
+  static thread_local std::map<std::string, SimulationObject*> so_list_;  //!< list of objects with simulation parameters on this thread
 };
 
 /**
@@ -139,13 +139,13 @@ libra::Vector<3> SampleComponents::GenerateTorque_Nm_b() {
 }
 
 void SampleComponents::LogSetup(Logger& logger) {
-  logger.AddLoggable(gyro_);
-  logger.AddLoggable(mag_sensor_);
-  logger.AddLoggable(stt_);
-  logger.AddLoggable(sun_sensor_);
-  logger.AddLoggable(gnss_);
-  logger.AddLoggable(mag_torquer_);
-  logger.AddLoggable(rw_);
-  logger.AddLoggable(thruster_);
-  logger.AddLoggable(force_generator_);
+  logger.AddLoggable(gyro_, "component");
+  logger.AddLoggable(mag_sensor_, "component");
+  logger.AddLoggable(stt_, "component");
+  logger.AddLoggable(sun_sensor_, "component");
+  logger.AddLoggable(gnss_, "component");
+  logger.AddLoggable(mag_torquer_, "component");
+  logger.AddLoggable(rw_, "component");
+  logger.AddLoggable(thruster_, "component");
+  logger.AddLoggable(force_generator_, "component");
 }